@@ -0,0 +1,85 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#ifndef BENCH_UTILS_HPP_
+#define BENCH_UTILS_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#ifndef DATASKETCHES_CPP_VERSION
+#define DATASKETCHES_CPP_VERSION "unknown"
+#endif
+
+// deterministic input generator, same sequence on every run and platform
+class splitmix64 {
+public:
+  explicit splitmix64(uint64_t seed): state_(seed) {}
+  uint64_t operator()() {
+    uint64_t z = (state_ += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+  }
+private:
+  uint64_t state_;
+};
+
+struct bench_config {
+  size_t num_items = 1000000;  // items per update benchmark
+  size_t num_sketches = 1000;  // sketches per union/merge and query benchmark
+  size_t repetitions = 5;
+  std::string filter;          // run only families whose name contains this
+};
+
+// keeps the optimizer from discarding benchmarked work
+inline volatile double bench_sink = 0;
+
+/**
+ * Runs the given operation the configured number of times and prints one JSON line
+ * with the best and median nanoseconds per item.
+ * The operation returns a value that is folded into bench_sink.
+ */
+template<typename Op>
+void run_bench(const bench_config& config, const std::string& family, const std::string& variant,
+    const std::string& op_name, size_t items_per_run, Op&& op) {
+  std::vector<double> ns_per_item;
+  ns_per_item.reserve(config.repetitions);
+  for (size_t i = 0; i < config.repetitions; ++i) {
+    const auto start = std::chrono::steady_clock::now();
+    bench_sink = bench_sink + static_cast<double>(op());
+    const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    ns_per_item.push_back(elapsed / items_per_run);
+  }
+  std::sort(ns_per_item.begin(), ns_per_item.end());
+  std::printf(
+    "{\"version\":\"%s\",\"family\":\"%s\",\"variant\":\"%s\",\"op\":\"%s\",\"items\":%zu,\"reps\":%zu,"
+    "\"best_ns_per_item\":%.3f,\"median_ns_per_item\":%.3f}\n",
+    DATASKETCHES_CPP_VERSION, family.c_str(), variant.c_str(), op_name.c_str(), items_per_run, config.repetitions,
+    ns_per_item.front(), ns_per_item[ns_per_item.size() / 2]
+  );
+  std::fflush(stdout);
+}
+
+#endif
@@ -0,0 +1,183 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Per-call cost of the embind bindings and of the plain C entry points for the same operations.
+// The modules must be built to load in Node.js:
+//   make theta hll cpc kll ENVIRONMENT=shell,node
+//   node bench/c_api_bench.mjs [calls]
+// Prints one JSON line per operation with nanoseconds per call for both and the difference.
+
+import thetaFactory from "../theta/theta_sketch.mjs";
+import hllFactory from "../hll/hll_sketch.mjs";
+import cpcFactory from "../cpc/cpc_sketch.mjs";
+import kllFactory from "../kll/kll_sketch_float.mjs";
+
+const calls = process.argv.length > 2 ? Number(process.argv[2]) : 1000000;
+const reps = 5;
+const seed = 9001n;
+const encoder = new TextEncoder();
+const strings = Array.from({length: 1024}, (_, i) => "item" + i);
+let sink = 0;
+
+function nsPerCall(op, n) {
+  const results = [];
+  for (let r = 0; r < reps; r++) {
+    const start = process.hrtime.bigint();
+    for (let i = 0; i < n; i++) sink += op(i) || 0;
+    results.push(Number(process.hrtime.bigint() - start) / n);
+  }
+  results.sort((a, b) => a - b);
+  return results[Math.floor(results.length / 2)];
+}
+
+function report(family, op, n, embindOp, cOp) {
+  const embind = nsPerCall(embindOp, n);
+  const c = nsPerCall(cOp, n);
+  console.log(JSON.stringify({
+    family: family, op: op, calls: n,
+    embind_ns_per_call: Number(embind.toFixed(1)),
+    c_ns_per_call: Number(c.toFixed(1)),
+    removed_ns_per_call: Number((embind - c).toFixed(1))
+  }));
+}
+
+// reusable heap buffer as in the UDFs
+function heapBuffer(Module, size) {
+  const ptr = Module._malloc(size);
+  return {
+    ptr: ptr,
+    size: size,
+    set: (bytes) => { Module.HEAPU8.set(bytes, ptr); return bytes.length; },
+    setString: (str) => encoder.encodeInto(str, Module.HEAPU8.subarray(ptr, ptr + size)).written
+  };
+}
+
+function benchCountSketch(family, Module, embind, c) {
+  const buffer = heapBuffer(Module, 1 << 20);
+  const sketch = embind.newSketch();
+  const handle = c.newSketch();
+  report(family, "update_int64", calls,
+    (i) => sketch.updateInt64(BigInt(i)),
+    (i) => c.updateInt64(handle, BigInt(i)));
+  report(family, "update_string", calls,
+    (i) => sketch.updateString(strings[i & 1023]),
+    (i) => c.updateString(handle, buffer.ptr, buffer.setString(strings[i & 1023])));
+
+  const bytes = embind.serialize(sketch);
+  const n = Math.max(1, calls / 100);
+  report(family, "serialize", n,
+    () => embind.serialize(sketch).length,
+    () => Module.HEAPU8.slice(buffer.ptr, buffer.ptr + c.serializeInto(handle, buffer.ptr, buffer.size)).length);
+  report(family, "get_estimate", n,
+    () => embind.getEstimate(bytes),
+    () => c.getEstimate(buffer.ptr, buffer.set(bytes)));
+
+  const union = embind.newUnion();
+  const unionHandle = c.newUnion();
+  report(family, "union_update", n,
+    () => embind.unionUpdate(union, bytes),
+    () => c.unionUpdate(unionHandle, buffer.ptr, buffer.set(bytes)));
+
+  sketch.delete();
+  union.delete();
+  c.destroySketch(handle);
+  c.destroyUnion(unionHandle);
+  Module._free(buffer.ptr);
+}
+
+const theta = await thetaFactory();
+benchCountSketch("theta", theta, {
+  newSketch: () => new theta.update_theta_sketch(12, seed, 1),
+  newUnion: () => new theta.theta_union(12, seed),
+  serialize: (sketch) => sketch.serializeAsUint8ArrayCompressed(),
+  getEstimate: (bytes) => theta.compact_theta_sketch.getEstimateFromBytes(bytes, seed),
+  unionUpdate: (union, bytes) => union.updateWithBytes(bytes, seed)
+}, {
+  newSketch: () => theta._theta_sketch_create(12, seed, 1),
+  newUnion: () => theta._theta_union_create(12, seed),
+  destroySketch: (h) => theta._theta_sketch_destroy(h),
+  destroyUnion: (h) => theta._theta_union_destroy(h),
+  updateInt64: (h, v) => theta._theta_sketch_update_int64(h, v),
+  updateString: (h, ptr, size) => theta._theta_sketch_update_string(h, ptr, size),
+  serializeInto: (h, ptr, size) => theta._theta_sketch_serialize_into(h, ptr, size),
+  getEstimate: (ptr, size) => theta._theta_get_estimate(ptr, size, seed),
+  unionUpdate: (h, ptr, size) => theta._theta_union_update(h, ptr, size, seed)
+});
+
+const hll = await hllFactory();
+benchCountSketch("hll", hll, {
+  newSketch: () => new hll.hll_sketch(12, "HLL_4"),
+  newUnion: () => new hll.hll_union(12),
+  serialize: (sketch) => sketch.serializeAsUint8Array(),
+  getEstimate: (bytes) => hll.hll_sketch.getEstimate(bytes),
+  unionUpdate: (union, bytes) => union.updateWithBytes(bytes)
+}, {
+  newSketch: () => hll._hll_sketch_create(12, 4),
+  newUnion: () => hll._hll_union_create(12),
+  destroySketch: (h) => hll._hll_sketch_destroy(h),
+  destroyUnion: (h) => hll._hll_union_destroy(h),
+  updateInt64: (h, v) => hll._hll_sketch_update_int64(h, v),
+  updateString: (h, ptr, size) => hll._hll_sketch_update_string(h, ptr, size),
+  serializeInto: (h, ptr, size) => hll._hll_sketch_serialize_into(h, ptr, size),
+  getEstimate: (ptr, size) => hll._hll_get_estimate(ptr, size),
+  unionUpdate: (h, ptr, size) => hll._hll_union_update(h, ptr, size)
+});
+
+const cpc = await cpcFactory();
+benchCountSketch("cpc", cpc, {
+  newSketch: () => new cpc.cpc_sketch(11, seed),
+  newUnion: () => new cpc.cpc_union(11, seed),
+  serialize: (sketch) => sketch.serializeAsUint8Array(),
+  getEstimate: (bytes) => cpc.cpc_sketch.getEstimate(bytes, seed),
+  unionUpdate: (union, bytes) => union.updateWithBytes(bytes, seed)
+}, {
+  newSketch: () => cpc._cpc_sketch_create(11, seed),
+  newUnion: () => cpc._cpc_union_create(11, seed),
+  destroySketch: (h) => cpc._cpc_sketch_destroy(h),
+  destroyUnion: (h) => cpc._cpc_union_destroy(h),
+  updateInt64: (h, v) => cpc._cpc_sketch_update_int64(h, v),
+  updateString: (h, ptr, size) => cpc._cpc_sketch_update_string(h, ptr, size),
+  serializeInto: (h, ptr, size) => cpc._cpc_sketch_serialize_into(h, ptr, size),
+  getEstimate: (ptr, size) => cpc._cpc_get_estimate(ptr, size, seed),
+  unionUpdate: (h, ptr, size) => cpc._cpc_union_update(h, ptr, size, seed)
+});
+
+const kll = await kllFactory();
+{
+  const buffer = heapBuffer(kll, 1 << 20);
+  const sketch = new kll.kll_sketch_float(200);
+  const handle = kll._kll_sketch_float_create(200);
+  report("kll_float", "update", calls,
+    (i) => sketch.update(i),
+    (i) => kll._kll_sketch_float_update(handle, i));
+  const bytes = sketch.serializeAsUint8Array();
+  const n = Math.max(1, calls / 100);
+  report("kll_float", "serialize", n,
+    () => sketch.serializeAsUint8Array().length,
+    () => kll.HEAPU8.slice(buffer.ptr, buffer.ptr + kll._kll_sketch_float_serialize_into(handle, buffer.ptr, buffer.size)).length);
+  report("kll_float", "get_quantile", n,
+    () => kll.kll_sketch_float.getQuantileFromBytes(bytes, 0.5, true),
+    () => kll._kll_sketch_float_get_quantile(buffer.ptr, buffer.set(bytes), 0.5, true));
+  report("kll_float", "merge", n,
+    () => sketch.merge(bytes),
+    () => kll._kll_sketch_float_merge(handle, buffer.ptr, buffer.set(bytes)));
+  sketch.delete();
+  kll._kll_sketch_float_destroy(handle);
+  kll._free(buffer.ptr);
+}
+
+if (sink === 0.123) console.log(sink);
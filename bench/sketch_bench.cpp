@@ -0,0 +1,867 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <theta_sketch.hpp>
+#include <theta_union.hpp>
+#include <theta_intersection.hpp>
+#include <theta_a_not_b.hpp>
+#include <theta_jaccard_similarity.hpp>
+#include <hll.hpp>
+#include <cpc_sketch.hpp>
+#include <cpc_union.hpp>
+#include <kll_sketch.hpp>
+#include <req_sketch.hpp>
+#include <tdigest.hpp>
+#include <frequent_items_sketch.hpp>
+
+#include "batch_update_theta_sketch.hpp"
+#include "cpc_preamble_estimate.hpp"
+#include "hll_preamble_estimate.hpp"
+#include "hll_register_union.hpp"
+#include "jaccard_matrix.hpp"
+#include "kll_merge_serialized.hpp"
+#include "req_merge_serialized.hpp"
+#include "sketch_cache.hpp"
+#include "tuple_sketch_int64.hpp"
+#include "wrapped_compact_tuple_sketch_int64.hpp"
+#include "theta_sorted_set_operations.hpp"
+#include "bench_utils.hpp"
+
+using datasketches::update_theta_sketch;
+using datasketches::compact_theta_sketch;
+using datasketches::wrapped_compact_theta_sketch;
+using datasketches::theta_union;
+using datasketches::theta_intersection;
+using datasketches::theta_a_not_b;
+using kll_sketch_float = datasketches::kll_sketch<float>;
+using req_sketch_float = datasketches::req_sketch<float>;
+using tdigest_double = datasketches::tdigest_double;
+using frequent_strings_sketch = datasketches::frequent_items_sketch<std::string>;
+
+using bytes_list = std::vector<std::vector<uint8_t>>;
+
+struct bench_data {
+  std::vector<uint64_t> values;
+  std::vector<std::string> strings; // about 10 repetitions of each string
+  std::vector<float> floats;
+  std::vector<double> doubles;
+
+  explicit bench_data(size_t n) {
+    splitmix64 random(42);
+    values.reserve(n);
+    strings.reserve(n);
+    floats.reserve(n);
+    doubles.reserve(n);
+    const uint64_t num_distinct_strings = std::max<uint64_t>(n / 10, 1);
+    for (size_t i = 0; i < n; ++i) {
+      const uint64_t value = random();
+      values.push_back(value);
+      strings.push_back(std::to_string(value % num_distinct_strings));
+      const double uniform = static_cast<double>(value >> 11) / static_cast<double>(1ULL << 53);
+      floats.push_back(static_cast<float>(uniform * 1000));
+      doubles.push_back(uniform * 1000);
+    }
+  }
+};
+
+// builds config.num_sketches sketches, each from its own slice of the input
+template<typename Make, typename Update>
+auto build_sketches(const bench_config& config, const bench_data& data, Make&& make, Update&& update) -> std::vector<decltype(make())> {
+  std::vector<decltype(make())> sketches;
+  sketches.reserve(config.num_sketches);
+  const size_t per_sketch = data.values.size() / config.num_sketches;
+  for (size_t i = 0; i < config.num_sketches; ++i) {
+    auto sketch = make();
+    for (size_t j = i * per_sketch; j < (i + 1) * per_sketch; ++j) update(sketch, j);
+    sketches.push_back(std::move(sketch));
+  }
+  return sketches;
+}
+
+template<typename Sketches, typename Serialize>
+bytes_list serialize_all(const Sketches& sketches, Serialize&& serialize) {
+  bytes_list list;
+  list.reserve(sketches.size());
+  for (const auto& sketch: sketches) {
+    auto bytes = serialize(sketch);
+    list.emplace_back(bytes.begin(), bytes.end());
+  }
+  return list;
+}
+
+// config.num_sketches serialized quantile sketches with the given number of floats each,
+// so that merges of inputs in exact and in estimation mode can be measured separately
+template<typename Make>
+bytes_list serialize_float_sketches(const bench_config& config, const bench_data& data, size_t items_per_sketch, Make&& make) {
+  bytes_list list;
+  list.reserve(config.num_sketches);
+  for (size_t i = 0; i < config.num_sketches; ++i) {
+    auto sketch = make();
+    for (size_t j = 0; j < items_per_sketch; ++j) sketch.update(data.floats[(i * items_per_sketch + j) % data.floats.size()]);
+    const auto bytes = sketch.serialize();
+    list.emplace_back(bytes.begin(), bytes.end());
+  }
+  return list;
+}
+
+static void bench_theta(const bench_config& config, const bench_data& data) {
+  const std::string family = "theta";
+  const std::string variant = "lg_k=12";
+  run_bench(config, family, variant, "update_int64", data.values.size(), [&]() {
+    auto sketch = update_theta_sketch::builder().build();
+    for (const auto value: data.values) sketch.update(value);
+    return sketch.get_estimate();
+  });
+  run_bench(config, family, variant, "update_string", data.strings.size(), [&]() {
+    auto sketch = update_theta_sketch::builder().build();
+    for (const auto& str: data.strings) sketch.update(str);
+    return sketch.get_estimate();
+  });
+  const uint8_t lg_k = datasketches::theta_constants::DEFAULT_LG_K;
+  {
+    // the batch path must produce exactly the same sketch
+    batch_update_theta_sketch batch_sketch(lg_k, datasketches::DEFAULT_SEED, 1);
+    batch_sketch.update_batch(data.values.data(), data.values.size());
+    auto sketch = update_theta_sketch::builder().build();
+    for (const auto value: data.values) sketch.update(value);
+    if (batch_sketch.compact().serialize() != sketch.compact().serialize()) {
+      throw std::runtime_error("theta batch update result differs from update(uint64_t)");
+    }
+  }
+  run_bench(config, family, variant, "update_int64_batch", data.values.size(), [&]() {
+    batch_update_theta_sketch sketch(lg_k, datasketches::DEFAULT_SEED, 1);
+    sketch.update_batch(data.values.data(), data.values.size());
+    return sketch.get_estimate();
+  });
+
+  const auto sketches = build_sketches(config, data,
+    []() { return update_theta_sketch::builder().build(); },
+    [&data](update_theta_sketch& sketch, size_t i) { sketch.update(data.values[i]); }
+  );
+  const auto serialize = [](const update_theta_sketch& sketch) { return sketch.compact().serialize_compressed(); };
+  run_bench(config, family, variant, "serialize_compressed", sketches.size(), [&]() {
+    size_t size = 0;
+    for (const auto& sketch: sketches) size += serialize(sketch).size();
+    return size;
+  });
+  const auto bytes_list = serialize_all(sketches, serialize);
+  run_bench(config, family, variant, "deserialize", bytes_list.size(), [&]() {
+    uint64_t num = 0;
+    for (const auto& bytes: bytes_list) num += compact_theta_sketch::deserialize(bytes.data(), bytes.size()).get_num_retained();
+    return num;
+  });
+  run_bench(config, family, variant, "union_wrapped", bytes_list.size(), [&]() {
+    auto u = theta_union::builder().build();
+    for (const auto& bytes: bytes_list) u.update(wrapped_compact_theta_sketch::wrap(bytes.data(), bytes.size()));
+    return u.get_result().get_estimate();
+  });
+  run_bench(config, family, variant, "get_estimate_wrapped", bytes_list.size(), [&]() {
+    double sum = 0;
+    for (const auto& bytes: bytes_list) sum += wrapped_compact_theta_sketch::wrap(bytes.data(), bytes.size()).get_estimate();
+    return sum;
+  });
+
+  // all pairs of the first 100 sketches
+  std::vector<wrapped_compact_theta_sketch> wrapped;
+  for (size_t i = 0; i < std::min<size_t>(bytes_list.size(), 100); ++i) {
+    wrapped.push_back(wrapped_compact_theta_sketch::wrap(bytes_list[i].data(), bytes_list[i].size()));
+  }
+  using theta_jaccard_matrix = jaccard_matrix<wrapped_compact_theta_sketch, datasketches::theta_jaccard_similarity>;
+  const size_t num_pairs = wrapped.size() * (wrapped.size() - 1) / 2;
+  {
+    // the matrix must match theta_jaccard_similarity for every pair
+    const theta_jaccard_matrix matrix(wrapped, datasketches::DEFAULT_SEED);
+    std::vector<double> values(matrix.get_num_values());
+    matrix.compute(values.data(), std::thread::hardware_concurrency());
+    size_t k = 0;
+    for (size_t i = 0; i < wrapped.size(); ++i) {
+      for (size_t j = i + 1; j < wrapped.size(); ++j, k += 3) {
+        const auto expected = datasketches::theta_jaccard_similarity::jaccard(wrapped[i], wrapped[j]);
+        if (values[k] != expected[0] || values[k + 1] != expected[1] || values[k + 2] != expected[2]) {
+          throw std::runtime_error("theta jaccard matrix differs from theta_jaccard_similarity");
+        }
+      }
+    }
+  }
+  run_bench(config, family, variant, "jaccard_pairwise", num_pairs, [&]() {
+    double sum = 0;
+    for (size_t i = 0; i < wrapped.size(); ++i) {
+      for (size_t j = i + 1; j < wrapped.size(); ++j) sum += datasketches::theta_jaccard_similarity::jaccard(wrapped[i], wrapped[j])[1];
+    }
+    return sum;
+  });
+  for (const size_t threads: {static_cast<size_t>(1), std::max<size_t>(1, std::thread::hardware_concurrency())}) {
+    run_bench(config, family, variant, "jaccard_matrix_threads=" + std::to_string(threads), num_pairs, [&]() {
+      const theta_jaccard_matrix matrix(wrapped, datasketches::DEFAULT_SEED);
+      std::vector<double> values(matrix.get_num_values());
+      matrix.compute(values.data(), threads);
+      return values.empty() ? 0 : values[1];
+    });
+  }
+}
+
+// intersection and A-not-B of serialized sketches of very different sizes, as in thetaIntersectionCompressed
+static void bench_theta_set_operations(const bench_config& config, const bench_data& data) {
+  const std::string family = "theta";
+  const std::string variant = "set_operations";
+  const size_t n = data.values.size();
+  // all items with lg_k=16, half of them with lg_k=12, a few hundred items in exact mode, nothing,
+  // and one item rejected by sampling (estimation mode without entries), serialized, compressed, and also unordered
+  auto large = update_theta_sketch::builder().set_lg_k(16).build();
+  auto half = update_theta_sketch::builder().build();
+  auto small = update_theta_sketch::builder().build();
+  auto empty = update_theta_sketch::builder().build();
+  for (size_t i = 0; i < n; ++i) {
+    large.update(data.values[i]);
+    if (i % 2 == 0) half.update(data.values[i]);
+    if (i % std::max<size_t>(n / 300, 1) == 0) small.update(data.values[i]);
+  }
+  for (size_t i = 0; i < 100; ++i) small.update(n + i);
+  auto sampled = []() {
+    for (uint64_t key = 0;; ++key) {
+      auto sketch = update_theta_sketch::builder().set_p(0.5f).build();
+      sketch.update(key);
+      if (sketch.get_num_retained() == 0) return sketch;
+    }
+  }();
+  bytes_list inputs;
+  for (const auto* sketch: {&large, &half, &small, &empty, &sampled}) {
+    const auto compact = sketch->compact();
+    const auto bytes = compact.serialize();
+    const auto compressed = compact.serialize_compressed();
+    inputs.emplace_back(bytes.begin(), bytes.end());
+    inputs.emplace_back(compressed.begin(), compressed.end());
+  }
+  for (const auto* sketch: {&half, &small}) {
+    const auto unordered = sketch->compact(false).serialize();
+    inputs.emplace_back(unordered.begin(), unordered.end());
+  }
+
+  const auto intersection_wrapped = [](const std::vector<uint8_t>& a, const std::vector<uint8_t>& b) {
+    theta_intersection intersection;
+    intersection.update(wrapped_compact_theta_sketch::wrap(a.data(), a.size()));
+    intersection.update(wrapped_compact_theta_sketch::wrap(b.data(), b.size()));
+    return intersection.get_result().serialize_compressed();
+  };
+  const auto a_not_b_wrapped = [](const std::vector<uint8_t>& a, const std::vector<uint8_t>& b) {
+    return theta_a_not_b().compute(
+      wrapped_compact_theta_sketch::wrap(a.data(), a.size()),
+      wrapped_compact_theta_sketch::wrap(b.data(), b.size())
+    ).serialize_compressed();
+  };
+  const auto intersection_sorted = [](const std::vector<uint8_t>& a, const std::vector<uint8_t>& b) {
+    return theta_sorted_set_operations::intersection(a.data(), a.size(), b.data(), b.size(), datasketches::DEFAULT_SEED).serialize_compressed();
+  };
+  const auto a_not_b_sorted = [](const std::vector<uint8_t>& a, const std::vector<uint8_t>& b) {
+    return theta_sorted_set_operations::a_not_b(a.data(), a.size(), b.data(), b.size(), datasketches::DEFAULT_SEED).serialize_compressed();
+  };
+  // the merge-joins must produce exactly the same sketches for every pair of inputs
+  for (const auto& a: inputs) {
+    for (const auto& b: inputs) {
+      if (intersection_sorted(a, b) != intersection_wrapped(a, b)) {
+        throw std::runtime_error("theta sorted intersection differs from theta_intersection");
+      }
+      if (a_not_b_sorted(a, b) != a_not_b_wrapped(a, b)) {
+        throw std::runtime_error("theta sorted a_not_b differs from theta_a_not_b");
+      }
+    }
+  }
+
+  // pairs of uncompressed and of compressed inputs, skipping the empty sketch
+  const size_t num_pairs = 2 * 3 * 3;
+  const auto run_pairs = [&inputs](const auto& op) {
+    size_t size = 0;
+    for (size_t compressed = 0; compressed < 2; ++compressed) {
+      for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) size += op(inputs[2 * i + compressed], inputs[2 * j + compressed]).size();
+      }
+    }
+    return size;
+  };
+  run_bench(config, family, variant, "intersection_wrapped", num_pairs, [&]() { return run_pairs(intersection_wrapped); });
+  run_bench(config, family, variant, "intersection_sorted", num_pairs, [&]() { return run_pairs(intersection_sorted); });
+  run_bench(config, family, variant, "a_not_b_wrapped", num_pairs, [&]() { return run_pairs(a_not_b_wrapped); });
+  run_bench(config, family, variant, "a_not_b_sorted", num_pairs, [&]() { return run_pairs(a_not_b_sorted); });
+}
+
+static void bench_tuple(const bench_config& config, const bench_data& data) {
+  const std::string family = "tuple_int64";
+  const std::vector<std::pair<tuple_mode, std::string>> modes = {
+    {SUM, "SUM"}, {MIN, "MIN"}, {MAX, "MAX"}, {ONE, "ONE"}, {NOP, "NOP"}
+  };
+  for (const auto& mode: modes) {
+    const std::string variant = "lg_k=12,mode=" + mode.second;
+    const uint8_t lg_k = datasketches::theta_constants::DEFAULT_LG_K;
+    run_bench(config, family, variant, "update_int64", data.values.size(), [&]() {
+      update_tuple_sketch_int64 sketch(lg_k, datasketches::DEFAULT_SEED, 1, mode.first);
+      for (const auto value: data.values) sketch.update(value, value & 0xffff);
+      return sketch.get_estimate();
+    });
+    std::vector<Update> values;
+    for (const auto value: data.values) values.push_back(value & 0xffff);
+    {
+      // the batch path must build exactly the same sketch
+      update_tuple_sketch_int64 sketch(lg_k, datasketches::DEFAULT_SEED, 1, mode.first);
+      update_tuple_sketch_int64 batch_sketch(lg_k, datasketches::DEFAULT_SEED, 1, mode.first);
+      for (size_t i = 0; i < data.values.size(); ++i) sketch.update(data.values[i], values[i]);
+      batch_sketch.update_batch(data.values.data(), values.data(), data.values.size());
+      if (sketch.compact().serialize() != batch_sketch.compact().serialize()) {
+        throw std::runtime_error("tuple batch update result differs from update");
+      }
+    }
+    run_bench(config, family, variant, "update_int64_batch", data.values.size(), [&]() {
+      update_tuple_sketch_int64 sketch(lg_k, datasketches::DEFAULT_SEED, 1, mode.first);
+      sketch.update_batch(data.values.data(), values.data(), data.values.size());
+      return sketch.get_estimate();
+    });
+    run_bench(config, family, variant, "update_string", data.strings.size(), [&]() {
+      update_tuple_sketch_int64 sketch(lg_k, datasketches::DEFAULT_SEED, 1, mode.first);
+      for (const auto& str: data.strings) sketch.update(str, 1);
+      return sketch.get_estimate();
+    });
+
+    const auto sketches = build_sketches(config, data,
+      [&]() { return update_tuple_sketch_int64(lg_k, datasketches::DEFAULT_SEED, 1, mode.first); },
+      [&data](update_tuple_sketch_int64& sketch, size_t i) { sketch.update(data.values[i], data.values[i] & 0xffff); }
+    );
+    const auto serialize = [](const update_tuple_sketch_int64& sketch) { return sketch.compact().serialize(); };
+    run_bench(config, family, variant, "serialize", sketches.size(), [&]() {
+      size_t size = 0;
+      for (const auto& sketch: sketches) size += serialize(sketch).size();
+      return size;
+    });
+    const auto bytes_list = serialize_all(sketches, serialize);
+    run_bench(config, family, variant, "deserialize", bytes_list.size(), [&]() {
+      uint64_t num = 0;
+      for (const auto& bytes: bytes_list) num += compact_tuple_sketch_int64::deserialize(bytes.data(), bytes.size()).get_num_retained();
+      return num;
+    });
+    run_bench(config, family, variant, "union", bytes_list.size(), [&]() {
+      tuple_union_int64 u(lg_k, datasketches::DEFAULT_SEED, mode.first);
+      for (const auto& bytes: bytes_list) u.update(compact_tuple_sketch_int64::deserialize(bytes.data(), bytes.size()));
+      return u.get_result().get_estimate();
+    });
+    run_bench(config, family, variant, "get_estimate", bytes_list.size(), [&]() {
+      double sum = 0;
+      for (const auto& bytes: bytes_list) sum += compact_tuple_sketch_int64::deserialize(bytes.data(), bytes.size()).get_estimate();
+      return sum;
+    });
+    run_bench(config, family, variant, "union_wrapped", bytes_list.size(), [&]() {
+      tuple_union_int64 u(lg_k, datasketches::DEFAULT_SEED, mode.first);
+      for (const auto& bytes: bytes_list) u.update(wrapped_compact_tuple_sketch_int64::wrap(bytes.data(), bytes.size()));
+      return u.get_result().get_estimate();
+    });
+    run_bench(config, family, variant, "get_estimate_wrapped", bytes_list.size(), [&]() {
+      double sum = 0;
+      for (const auto& bytes: bytes_list) sum += wrapped_compact_tuple_sketch_int64::wrap(bytes.data(), bytes.size()).get_estimate();
+      return sum;
+    });
+
+    const auto serialize_compressed = [](const update_tuple_sketch_int64& sketch) {
+      return wrapped_compact_tuple_sketch_int64::serialize_compressed(sketch.compact());
+    };
+    run_bench(config, family, variant, "serialize_compressed", sketches.size(), [&]() {
+      size_t size = 0;
+      for (const auto& sketch: sketches) size += serialize_compressed(sketch).size();
+      return size;
+    });
+    const auto compressed_list = serialize_all(sketches, serialize_compressed);
+    for (size_t i = 0; i < compressed_list.size(); ++i) {
+      const auto& compressed = compressed_list[i];
+      if (wrapped_compact_tuple_sketch_int64::deserialize_compact(compressed.data(), compressed.size()).serialize() != bytes_list[i]) {
+        throw std::runtime_error("tuple compressed serialization does not round trip");
+      }
+    }
+    run_bench(config, family, variant, "union_wrapped_compressed", compressed_list.size(), [&]() {
+      tuple_union_int64 u(lg_k, datasketches::DEFAULT_SEED, mode.first);
+      for (const auto& bytes: compressed_list) u.update(wrapped_compact_tuple_sketch_int64::wrap(bytes.data(), bytes.size()));
+      return u.get_result().get_estimate();
+    });
+  }
+}
+
+static void bench_hll(const bench_config& config, const bench_data& data) {
+  const std::string family = "hll";
+  const std::vector<std::pair<datasketches::target_hll_type, std::string>> types = {
+    {datasketches::HLL_4, "HLL_4"}, {datasketches::HLL_6, "HLL_6"}, {datasketches::HLL_8, "HLL_8"}
+  };
+  const uint8_t lg_k = 12;
+  for (const auto& type: types) {
+    const std::string variant = "lg_k=12,type=" + type.second;
+    run_bench(config, family, variant, "update_int64", data.values.size(), [&]() {
+      datasketches::hll_sketch sketch(lg_k, type.first);
+      for (const auto value: data.values) sketch.update(value);
+      return sketch.get_estimate();
+    });
+    run_bench(config, family, variant, "update_string", data.strings.size(), [&]() {
+      datasketches::hll_sketch sketch(lg_k, type.first);
+      for (const auto& str: data.strings) sketch.update(str);
+      return sketch.get_estimate();
+    });
+
+    const auto sketches = build_sketches(config, data,
+      [&]() { return datasketches::hll_sketch(lg_k, type.first); },
+      [&data](datasketches::hll_sketch& sketch, size_t i) { sketch.update(data.values[i]); }
+    );
+    const auto serialize = [](const datasketches::hll_sketch& sketch) { return sketch.serialize_compact(); };
+    run_bench(config, family, variant, "serialize_compact", sketches.size(), [&]() {
+      size_t size = 0;
+      for (const auto& sketch: sketches) size += serialize(sketch).size();
+      return size;
+    });
+    const auto bytes_list = serialize_all(sketches, serialize);
+    run_bench(config, family, variant, "deserialize", bytes_list.size(), [&]() {
+      double sum = 0;
+      for (const auto& bytes: bytes_list) sum += datasketches::hll_sketch::deserialize(bytes.data(), bytes.size()).get_lg_config_k();
+      return sum;
+    });
+    run_bench(config, family, variant, "union", bytes_list.size(), [&]() {
+      datasketches::hll_union u(lg_k);
+      for (const auto& bytes: bytes_list) u.update(datasketches::hll_sketch::deserialize(bytes.data(), bytes.size()));
+      return u.get_result(type.first).get_estimate();
+    });
+    {
+      // the register merge path must produce the same union
+      datasketches::hll_union u(lg_k);
+      hll_register_union ru(lg_k);
+      for (const auto& bytes: bytes_list) {
+        u.update(datasketches::hll_sketch::deserialize(bytes.data(), bytes.size()));
+        ru.update(bytes.data(), bytes.size());
+      }
+      if (u.get_result(datasketches::HLL_8).get_estimate() != ru.get_result(datasketches::HLL_8).get_estimate()) {
+        throw std::runtime_error("hll register union result differs from hll_union");
+      }
+    }
+    run_bench(config, family, variant, "union_registers", bytes_list.size(), [&]() {
+      hll_register_union u(lg_k);
+      for (const auto& bytes: bytes_list) u.update(bytes.data(), bytes.size());
+      return u.get_result(type.first).get_estimate();
+    });
+    run_bench(config, family, variant, "get_estimate", bytes_list.size(), [&]() {
+      double sum = 0;
+      for (const auto& bytes: bytes_list) sum += datasketches::hll_sketch::deserialize(bytes.data(), bytes.size()).get_estimate();
+      return sum;
+    });
+    for (const auto& bytes: bytes_list) {
+      // the preamble path must match the deserialized sketch
+      const hll_preamble_estimate preamble(bytes.data(), bytes.size());
+      if (!preamble.is_available()) continue;
+      const auto sketch = datasketches::hll_sketch::deserialize(bytes.data(), bytes.size());
+      if (preamble.get_estimate() != sketch.get_estimate() || preamble.get_lower_bound(2) != sketch.get_lower_bound(2)
+        || preamble.get_upper_bound(2) != sketch.get_upper_bound(2)) {
+        throw std::runtime_error("hll preamble estimate differs from the deserialized sketch");
+      }
+    }
+    run_bench(config, family, variant, "get_estimate_preamble", bytes_list.size(), [&]() {
+      double sum = 0;
+      for (const auto& bytes: bytes_list) {
+        const hll_preamble_estimate preamble(bytes.data(), bytes.size());
+        sum += preamble.is_available() ? preamble.get_estimate() : datasketches::hll_sketch::deserialize(bytes.data(), bytes.size()).get_estimate();
+      }
+      return sum;
+    });
+  }
+}
+
+static void bench_cpc(const bench_config& config, const bench_data& data) {
+  const std::string family = "cpc";
+  const std::string variant = "lg_k=11";
+  const uint8_t lg_k = datasketches::cpc_constants::DEFAULT_LG_K;
+  run_bench(config, family, variant, "update_int64", data.values.size(), [&]() {
+    datasketches::cpc_sketch sketch(lg_k);
+    for (const auto value: data.values) sketch.update(value);
+    return sketch.get_estimate();
+  });
+  run_bench(config, family, variant, "update_string", data.strings.size(), [&]() {
+    datasketches::cpc_sketch sketch(lg_k);
+    for (const auto& str: data.strings) sketch.update(str);
+    return sketch.get_estimate();
+  });
+
+  const auto sketches = build_sketches(config, data,
+    [&]() { return datasketches::cpc_sketch(lg_k); },
+    [&data](datasketches::cpc_sketch& sketch, size_t i) { sketch.update(data.values[i]); }
+  );
+  const auto serialize = [](const datasketches::cpc_sketch& sketch) { return sketch.serialize(); };
+  run_bench(config, family, variant, "serialize", sketches.size(), [&]() {
+    size_t size = 0;
+    for (const auto& sketch: sketches) size += serialize(sketch).size();
+    return size;
+  });
+  const auto bytes_list = serialize_all(sketches, serialize);
+  run_bench(config, family, variant, "deserialize", bytes_list.size(), [&]() {
+    double sum = 0;
+    for (const auto& bytes: bytes_list) sum += datasketches::cpc_sketch::deserialize(bytes.data(), bytes.size()).get_lg_k();
+    return sum;
+  });
+  run_bench(config, family, variant, "union", bytes_list.size(), [&]() {
+    datasketches::cpc_union u(lg_k);
+    for (const auto& bytes: bytes_list) u.update(datasketches::cpc_sketch::deserialize(bytes.data(), bytes.size()));
+    return u.get_result().get_estimate();
+  });
+  run_bench(config, family, variant, "get_estimate", bytes_list.size(), [&]() {
+    double sum = 0;
+    for (const auto& bytes: bytes_list) sum += datasketches::cpc_sketch::deserialize(bytes.data(), bytes.size()).get_estimate();
+    return sum;
+  });
+  {
+    // the preamble path must match the deserialized sketch, with HIP (as built) and with ICON (merged),
+    // also empty and with lg_k at both ends and above the range of the measured error tables
+    datasketches::cpc_union u(lg_k);
+    for (const auto& bytes: bytes_list) u.update(datasketches::cpc_sketch::deserialize(bytes.data(), bytes.size()));
+    auto checked = bytes_list;
+    checked.push_back(u.get_result().serialize());
+    checked.push_back(datasketches::cpc_sketch(lg_k).serialize());
+    for (const uint8_t other_lg_k: {4, 14, 16}) {
+      datasketches::cpc_sketch sketch(other_lg_k);
+      for (size_t i = 0; i < std::min<size_t>(data.values.size(), 100000); ++i) sketch.update(data.values[i]);
+      datasketches::cpc_union other_union(other_lg_k);
+      other_union.update(sketch);
+      checked.push_back(sketch.serialize());
+      checked.push_back(other_union.get_result().serialize());
+    }
+    for (const auto& bytes: checked) {
+      const cpc_preamble_estimate preamble(bytes.data(), bytes.size(), datasketches::DEFAULT_SEED);
+      const auto sketch = datasketches::cpc_sketch::deserialize(bytes.data(), bytes.size());
+      if (!preamble.is_available() || preamble.get_estimate() != sketch.get_estimate()) {
+        throw std::runtime_error("cpc preamble estimate differs from the deserialized sketch");
+      }
+      for (uint8_t kappa = 1; kappa <= 3; ++kappa) {
+        if (preamble.get_lower_bound(kappa) != sketch.get_lower_bound(kappa) || preamble.get_upper_bound(kappa) != sketch.get_upper_bound(kappa)) {
+          throw std::runtime_error("cpc preamble bounds differ from the deserialized sketch");
+        }
+      }
+    }
+  }
+  run_bench(config, family, variant, "get_estimate_preamble", bytes_list.size(), [&]() {
+    double sum = 0;
+    for (const auto& bytes: bytes_list) sum += cpc_preamble_estimate(bytes.data(), bytes.size(), datasketches::DEFAULT_SEED).get_estimate();
+    return sum;
+  });
+  run_bench(config, family, variant, "get_bounds", bytes_list.size(), [&]() {
+    double sum = 0;
+    for (const auto& bytes: bytes_list) sum += datasketches::cpc_sketch::deserialize(bytes.data(), bytes.size()).get_upper_bound(2);
+    return sum;
+  });
+  run_bench(config, family, variant, "get_bounds_preamble", bytes_list.size(), [&]() {
+    double sum = 0;
+    for (const auto& bytes: bytes_list) sum += cpc_preamble_estimate(bytes.data(), bytes.size(), datasketches::DEFAULT_SEED).get_upper_bound(2);
+    return sum;
+  });
+}
+
+static void bench_kll(const bench_config& config, const bench_data& data) {
+  const std::string family = "kll_float";
+  const std::string variant = "k=200";
+  const uint16_t k = datasketches::kll_constants::DEFAULT_K;
+  run_bench(config, family, variant, "update", data.floats.size(), [&]() {
+    kll_sketch_float sketch(k);
+    for (const auto value: data.floats) sketch.update(value);
+    return sketch.get_n();
+  });
+
+  const auto sketches = build_sketches(config, data,
+    [&]() { return kll_sketch_float(k); },
+    [&data](kll_sketch_float& sketch, size_t i) { sketch.update(data.floats[i]); }
+  );
+  const auto serialize = [](const kll_sketch_float& sketch) { return sketch.serialize(); };
+  run_bench(config, family, variant, "serialize", sketches.size(), [&]() {
+    size_t size = 0;
+    for (const auto& sketch: sketches) size += serialize(sketch).size();
+    return size;
+  });
+  const auto bytes_list = serialize_all(sketches, serialize);
+  run_bench(config, family, variant, "deserialize", bytes_list.size(), [&]() {
+    uint64_t n = 0;
+    for (const auto& bytes: bytes_list) n += kll_sketch_float::deserialize(bytes.data(), bytes.size()).get_n();
+    return n;
+  });
+  run_bench(config, family, variant, "merge", bytes_list.size(), [&]() {
+    kll_sketch_float sketch(k);
+    for (const auto& bytes: bytes_list) sketch.merge(kll_sketch_float::deserialize(bytes.data(), bytes.size()));
+    return sketch.get_n();
+  });
+  {
+    // merging from the bytes must produce the same sketch
+    kll_sketch_float merged(k);
+    kll_sketch_float merged_serialized(k);
+    for (const auto& bytes: bytes_list) {
+      merged.merge(kll_sketch_float::deserialize(bytes.data(), bytes.size()));
+      kll_merge_serialized(merged_serialized, bytes.data(), bytes.size());
+    }
+    if (merged.serialize() != merged_serialized.serialize()) {
+      throw std::runtime_error("kll merge from serialized bytes differs from merge");
+    }
+  }
+  run_bench(config, family, variant, "merge_serialized", bytes_list.size(), [&]() {
+    kll_sketch_float sketch(k);
+    for (const auto& bytes: bytes_list) kll_merge_serialized(sketch, bytes.data(), bytes.size());
+    return sketch.get_n();
+  });
+  // only inputs in exact mode are read from the bytes, inputs in estimation mode are still deserialized
+  for (const bool estimation_mode: {false, true}) {
+    const std::string inputs = estimation_mode ? "estimation" : "exact";
+    const auto inputs_list = serialize_float_sketches(config, data, estimation_mode ? 10 * k : k / 2, [&]() { return kll_sketch_float(k); });
+    if (kll_sketch_float::deserialize(inputs_list[0].data(), inputs_list[0].size()).is_estimation_mode() != estimation_mode) {
+      throw std::runtime_error("kll " + inputs + " mode inputs are in the wrong mode");
+    }
+    run_bench(config, family, variant, "merge_" + inputs + "_inputs", inputs_list.size(), [&]() {
+      kll_sketch_float sketch(k);
+      for (const auto& bytes: inputs_list) sketch.merge(kll_sketch_float::deserialize(bytes.data(), bytes.size()));
+      return sketch.get_n();
+    });
+    run_bench(config, family, variant, "merge_serialized_" + inputs + "_inputs", inputs_list.size(), [&]() {
+      kll_sketch_float sketch(k);
+      for (const auto& bytes: inputs_list) kll_merge_serialized(sketch, bytes.data(), bytes.size());
+      return sketch.get_n();
+    });
+  }
+  run_bench(config, family, variant, "get_quantile", bytes_list.size(), [&]() {
+    double sum = 0;
+    for (const auto& bytes: bytes_list) sum += kll_sketch_float::deserialize(bytes.data(), bytes.size()).get_quantile(0.5);
+    return sum;
+  });
+  run_bench(config, family, variant, "get_rank", bytes_list.size(), [&]() {
+    double sum = 0;
+    for (const auto& bytes: bytes_list) sum += kll_sketch_float::deserialize(bytes.data(), bytes.size()).get_rank(500);
+    return sum;
+  });
+  // two scalar functions over the same column, the second one served from the cache
+  std::vector<std::string> byte_strings;
+  for (const auto& bytes: bytes_list) byte_strings.emplace_back(bytes.begin(), bytes.end());
+  run_bench(config, family, variant, "get_quantile_cached", 2 * byte_strings.size(), [&]() {
+    sketch_cache<kll_sketch_float> cache(byte_strings.size());
+    const auto deserialize = [](const std::string& bytes) { return kll_sketch_float::deserialize(bytes.data(), bytes.size()); };
+    double sum = 0;
+    for (const auto& bytes: byte_strings) sum += cache.get(bytes, 0, deserialize)->get_n();
+    for (const auto& bytes: byte_strings) sum += cache.get(bytes, 0, deserialize)->get_quantile(0.5);
+    return sum;
+  });
+}
+
+static void bench_req(const bench_config& config, const bench_data& data) {
+  const std::string family = "req_float";
+  const std::string variant = "k=12,hra=true";
+  const uint16_t k = 12;
+  run_bench(config, family, variant, "update", data.floats.size(), [&]() {
+    req_sketch_float sketch(k, true);
+    for (const auto value: data.floats) sketch.update(value);
+    return sketch.get_n();
+  });
+
+  const auto sketches = build_sketches(config, data,
+    [&]() { return req_sketch_float(k, true); },
+    [&data](req_sketch_float& sketch, size_t i) { sketch.update(data.floats[i]); }
+  );
+  const auto serialize = [](const req_sketch_float& sketch) { return sketch.serialize(); };
+  run_bench(config, family, variant, "serialize", sketches.size(), [&]() {
+    size_t size = 0;
+    for (const auto& sketch: sketches) size += serialize(sketch).size();
+    return size;
+  });
+  const auto bytes_list = serialize_all(sketches, serialize);
+  run_bench(config, family, variant, "deserialize", bytes_list.size(), [&]() {
+    uint64_t n = 0;
+    for (const auto& bytes: bytes_list) n += req_sketch_float::deserialize(bytes.data(), bytes.size()).get_n();
+    return n;
+  });
+  run_bench(config, family, variant, "merge", bytes_list.size(), [&]() {
+    req_sketch_float sketch(k, true);
+    for (const auto& bytes: bytes_list) sketch.merge(req_sketch_float::deserialize(bytes.data(), bytes.size()));
+    return sketch.get_n();
+  });
+  {
+    // compaction may happen at different points, but the totals must agree
+    req_sketch_float merged(k, true);
+    req_sketch_float merged_serialized(k, true);
+    for (const auto& bytes: bytes_list) {
+      merged.merge(req_sketch_float::deserialize(bytes.data(), bytes.size()));
+      req_merge_serialized(merged_serialized, bytes.data(), bytes.size());
+    }
+    if (merged.get_n() != merged_serialized.get_n() || merged.get_min_item() != merged_serialized.get_min_item()
+      || merged.get_max_item() != merged_serialized.get_max_item()) {
+      throw std::runtime_error("req merge from serialized bytes differs from merge");
+    }
+  }
+  run_bench(config, family, variant, "merge_serialized", bytes_list.size(), [&]() {
+    req_sketch_float sketch(k, true);
+    for (const auto& bytes: bytes_list) req_merge_serialized(sketch, bytes.data(), bytes.size());
+    return sketch.get_n();
+  });
+  // only inputs in exact mode are read from the bytes, inputs in estimation mode are still deserialized
+  for (const bool estimation_mode: {false, true}) {
+    const std::string inputs = estimation_mode ? "estimation" : "exact";
+    const auto inputs_list = serialize_float_sketches(config, data, estimation_mode ? 100 * k : 4 * k, [&]() { return req_sketch_float(k, true); });
+    if (req_sketch_float::deserialize(inputs_list[0].data(), inputs_list[0].size()).is_estimation_mode() != estimation_mode) {
+      throw std::runtime_error("req " + inputs + " mode inputs are in the wrong mode");
+    }
+    run_bench(config, family, variant, "merge_" + inputs + "_inputs", inputs_list.size(), [&]() {
+      req_sketch_float sketch(k, true);
+      for (const auto& bytes: inputs_list) sketch.merge(req_sketch_float::deserialize(bytes.data(), bytes.size()));
+      return sketch.get_n();
+    });
+    run_bench(config, family, variant, "merge_serialized_" + inputs + "_inputs", inputs_list.size(), [&]() {
+      req_sketch_float sketch(k, true);
+      for (const auto& bytes: inputs_list) req_merge_serialized(sketch, bytes.data(), bytes.size());
+      return sketch.get_n();
+    });
+  }
+  run_bench(config, family, variant, "get_quantile", bytes_list.size(), [&]() {
+    double sum = 0;
+    for (const auto& bytes: bytes_list) sum += req_sketch_float::deserialize(bytes.data(), bytes.size()).get_quantile(0.5);
+    return sum;
+  });
+  run_bench(config, family, variant, "get_rank", bytes_list.size(), [&]() {
+    double sum = 0;
+    for (const auto& bytes: bytes_list) sum += req_sketch_float::deserialize(bytes.data(), bytes.size()).get_rank(500);
+    return sum;
+  });
+}
+
+static void bench_tdigest(const bench_config& config, const bench_data& data) {
+  const std::string family = "tdigest_double";
+  const std::string variant = "k=100";
+  const uint16_t k = tdigest_double::DEFAULT_K;
+  run_bench(config, family, variant, "update", data.doubles.size(), [&]() {
+    tdigest_double td(k);
+    for (const auto value: data.doubles) td.update(value);
+    return td.get_total_weight();
+  });
+
+  const auto sketches = build_sketches(config, data,
+    [&]() { return tdigest_double(k); },
+    [&data](tdigest_double& td, size_t i) { td.update(data.doubles[i]); }
+  );
+  const auto serialize = [](const tdigest_double& td) { return td.serialize(); };
+  run_bench(config, family, variant, "serialize", sketches.size(), [&]() {
+    size_t size = 0;
+    for (const auto& td: sketches) size += serialize(td).size();
+    return size;
+  });
+  const auto bytes_list = serialize_all(sketches, serialize);
+  run_bench(config, family, variant, "deserialize", bytes_list.size(), [&]() {
+    uint64_t weight = 0;
+    for (const auto& bytes: bytes_list) weight += tdigest_double::deserialize(bytes.data(), bytes.size()).get_total_weight();
+    return weight;
+  });
+  run_bench(config, family, variant, "merge", bytes_list.size(), [&]() {
+    tdigest_double td(k);
+    for (const auto& bytes: bytes_list) {
+      auto other = tdigest_double::deserialize(bytes.data(), bytes.size());
+      td.merge(other);
+    }
+    return td.get_total_weight();
+  });
+  run_bench(config, family, variant, "get_quantile", bytes_list.size(), [&]() {
+    double sum = 0;
+    for (const auto& bytes: bytes_list) sum += tdigest_double::deserialize(bytes.data(), bytes.size()).get_quantile(0.5);
+    return sum;
+  });
+  run_bench(config, family, variant, "get_rank", bytes_list.size(), [&]() {
+    double sum = 0;
+    for (const auto& bytes: bytes_list) sum += tdigest_double::deserialize(bytes.data(), bytes.size()).get_rank(500);
+    return sum;
+  });
+}
+
+static void bench_frequent_strings(const bench_config& config, const bench_data& data) {
+  const std::string family = "frequent_strings";
+  const std::string variant = "lg_max_map_size=10";
+  const uint8_t lg_max_map_size = 10;
+  run_bench(config, family, variant, "update", data.strings.size(), [&]() {
+    frequent_strings_sketch sketch(lg_max_map_size);
+    for (const auto& str: data.strings) sketch.update(str, 1);
+    return sketch.get_total_weight();
+  });
+
+  const auto sketches = build_sketches(config, data,
+    [&]() { return frequent_strings_sketch(lg_max_map_size); },
+    [&data](frequent_strings_sketch& sketch, size_t i) { sketch.update(data.strings[i], 1); }
+  );
+  const auto serialize = [](const frequent_strings_sketch& sketch) { return sketch.serialize(); };
+  run_bench(config, family, variant, "serialize", sketches.size(), [&]() {
+    size_t size = 0;
+    for (const auto& sketch: sketches) size += serialize(sketch).size();
+    return size;
+  });
+  const auto bytes_list = serialize_all(sketches, serialize);
+  run_bench(config, family, variant, "deserialize", bytes_list.size(), [&]() {
+    uint64_t weight = 0;
+    for (const auto& bytes: bytes_list) weight += frequent_strings_sketch::deserialize(bytes.data(), bytes.size()).get_total_weight();
+    return weight;
+  });
+  run_bench(config, family, variant, "merge", bytes_list.size(), [&]() {
+    frequent_strings_sketch sketch(lg_max_map_size);
+    for (const auto& bytes: bytes_list) sketch.merge(frequent_strings_sketch::deserialize(bytes.data(), bytes.size()));
+    return sketch.get_total_weight();
+  });
+  run_bench(config, family, variant, "get_frequent_items", bytes_list.size(), [&]() {
+    size_t num = 0;
+    for (const auto& bytes: bytes_list) {
+      num += frequent_strings_sketch::deserialize(bytes.data(), bytes.size()).get_frequent_items(datasketches::NO_FALSE_NEGATIVES).size();
+    }
+    return num;
+  });
+}
+
+static void usage(const char* name) {
+  std::cerr << "usage: " << name << " [--items N] [--sketches N] [--reps N] [--filter FAMILY]" << std::endl;
+  std::exit(1);
+}
+
+int main(int argc, char** argv) {
+  bench_config config;
+  for (int i = 1; i < argc; ++i) {
+    if (i + 1 >= argc) usage(argv[0]);
+    const std::string arg = argv[i];
+    const char* value = argv[++i];
+    if (arg == "--items") config.num_items = std::strtoull(value, nullptr, 10);
+    else if (arg == "--sketches") config.num_sketches = std::strtoull(value, nullptr, 10);
+    else if (arg == "--reps") config.repetitions = std::strtoull(value, nullptr, 10);
+    else if (arg == "--filter") config.filter = value;
+    else usage(argv[0]);
+  }
+  if (config.num_items == 0 || config.num_sketches == 0 || config.repetitions == 0 || config.num_sketches > config.num_items) usage(argv[0]);
+
+  const bench_data data(config.num_items);
+  const std::vector<std::pair<std::string, std::function<void(const bench_config&, const bench_data&)>>> families = {
+    {"theta", bench_theta},
+    {"theta", bench_theta_set_operations},
+    {"tuple_int64", bench_tuple},
+    {"hll", bench_hll},
+    {"cpc", bench_cpc},
+    {"kll_float", bench_kll},
+    {"req_float", bench_req},
+    {"tdigest_double", bench_tdigest},
+    {"frequent_strings", bench_frequent_strings}
+  };
+  for (const auto& family: families) {
+    if (family.first.find(config.filter) != std::string::npos) family.second(config, data);
+  }
+  return 0;
+}
@@ -0,0 +1,103 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Size and instantiation time of the full modules and of the slim query modules used by the scalar UDFs.
+// The modules must be built to load in Node.js:
+//   make theta tuple hll cpc ENVIRONMENT=shell,node
+//   node bench/startup_bench.mjs [runs]
+// Every cold start is measured in a fresh Node.js process: loading the module and the first ModuleFactory() call.
+// Warm instantiation is a repeated ModuleFactory() call in the same process.
+// Prints one JSON line per module with sizes in bytes and median times in milliseconds.
+
+import { execFileSync } from "node:child_process";
+import { existsSync, statSync } from "node:fs";
+import { fileURLToPath, pathToFileURL } from "node:url";
+import path from "node:path";
+
+const root = path.resolve(path.dirname(fileURLToPath(import.meta.url)), "..");
+const modules = [
+  "theta/theta_sketch",
+  "tuple/tuple_sketch_int64",
+  "hll/hll_sketch",
+  "cpc/cpc_sketch"
+];
+
+function median(values) {
+  const sorted = [...values].sort((a, b) => a - b);
+  return sorted[Math.floor(sorted.length / 2)];
+}
+
+function ms(start) {
+  return Number(process.hrtime.bigint() - start) / 1e6;
+}
+
+// child process: node startup_bench.mjs --cold <module.mjs>
+async function cold(file) {
+  const start = process.hrtime.bigint();
+  const factory = (await import(pathToFileURL(file))).default;
+  const loaded = ms(start);
+  await factory();
+  console.log(JSON.stringify({load_ms: loaded, total_ms: ms(start)}));
+}
+
+async function warm(file, runs) {
+  const factory = (await import(pathToFileURL(file))).default;
+  await factory();
+  const times = [];
+  for (let i = 0; i < runs; i++) {
+    const start = process.hrtime.bigint();
+    await factory();
+    times.push(ms(start));
+  }
+  return median(times);
+}
+
+function size(file) {
+  return existsSync(file) ? statSync(file).size : null;
+}
+
+async function measure(name, runs) {
+  const file = path.join(root, name + ".mjs");
+  const colds = [];
+  for (let i = 0; i < runs; i++) {
+    const out = execFileSync(process.execPath, [fileURLToPath(import.meta.url), "--cold", file]);
+    colds.push(JSON.parse(out.toString()));
+  }
+  return {
+    module: path.basename(name),
+    mjs_bytes: size(file),
+    js_bytes: size(path.join(root, name + ".js")),
+    cold_load_ms: Number(median(colds.map((c) => c.load_ms)).toFixed(2)),
+    cold_total_ms: Number(median(colds.map((c) => c.total_ms)).toFixed(2)),
+    warm_instantiate_ms: Number((await warm(file, runs)).toFixed(2))
+  };
+}
+
+if (process.argv[2] === "--cold") {
+  await cold(process.argv[3]);
+} else {
+  const runs = process.argv.length > 2 ? Number(process.argv[2]) : 10;
+  for (const name of modules) {
+    for (const variant of [name, name + "_query"]) {
+      if (!existsSync(path.join(root, variant + ".mjs"))) {
+        console.error(variant + ".mjs not found, skipping");
+        continue;
+      }
+      console.log(JSON.stringify(await measure(variant, runs)));
+    }
+  }
+}
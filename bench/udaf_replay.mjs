@@ -0,0 +1,260 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Offline replay of the aggregate functions (UDAFs) with the JavaScript code taken from the sqlx files.
+// The modules must be built to load in Node.js:
+//   make ENVIRONMENT=shell,node
+//   node bench/udaf_replay.mjs [--rows N] [--distinct N] [--partitions N] [--fan-in N] [--sketches N] [--filter text]
+// Every run follows the lifecycle of BigQuery: each partition starts with initialState() and calls aggregate()
+// for its rows, then its state goes through serialize() and deserialize() (with a structured clone in between,
+// as if it was sent to another worker). The states are merged in a tree of merge() calls with the given fan-in,
+// where every intermediate state is serialized and deserialized again, and the last one is passed to finalize().
+// Build functions get deterministic generated rows, union and merge functions get sketches produced by
+// the build function of the same family. Non-aggregate parameters are NULL, so the defaults are used.
+// Prints one JSON line per function with the throughput, the heap size and peak malloc footprint and the serialized sizes.
+
+import { mkdtempSync, readFileSync, rmSync, writeFileSync } from "node:fs";
+import { tmpdir } from "node:os";
+import { fileURLToPath, pathToFileURL } from "node:url";
+import path from "node:path";
+
+const root = path.resolve(path.dirname(fileURLToPath(import.meta.url)), "..");
+
+// build function and the function that merges its output
+const families = [
+  {name: "theta", build: "theta/sqlx/theta_sketch_agg_string_lgk_seed_p.sqlx", merge: "theta/sqlx/theta_sketch_agg_union_lgk_seed.sqlx"},
+  {name: "theta_int64", build: "theta/sqlx/theta_sketch_agg_int64_lgk_seed_p.sqlx", merge: null},
+  {name: "tuple_int64", build: "tuple/sqlx/tuple_sketch_int64_agg_string_lgk_seed_p_mode.sqlx", merge: "tuple/sqlx/tuple_sketch_int64_agg_union_lgk_seed_mode.sqlx"},
+  {name: "hll", build: "hll/sqlx/hll_sketch_agg_string_lgk_type.sqlx", merge: "hll/sqlx/hll_sketch_agg_union_lgk_type.sqlx"},
+  {name: "hll_int64", build: "hll/sqlx/hll_sketch_agg_int64_lgk_type.sqlx", merge: null},
+  {name: "cpc", build: "cpc/sqlx/cpc_sketch_agg_string_lgk_seed.sqlx", merge: "cpc/sqlx/cpc_sketch_agg_union_lgk_seed.sqlx"},
+  {name: "cpc_int64", build: "cpc/sqlx/cpc_sketch_agg_int64_lgk_seed.sqlx", merge: null},
+  {name: "kll_float", build: "kll/sqlx/kll_sketch_float_build_k.sqlx", merge: "kll/sqlx/kll_sketch_float_merge_k.sqlx"},
+  {name: "req_float", build: "req/sqlx/req_sketch_float_build_k_hra.sqlx", merge: "req/sqlx/req_sketch_float_merge_k_hra.sqlx"},
+  {name: "tdigest_double", build: "tdigest/sqlx/tdigest_double_build_k.sqlx", merge: "tdigest/sqlx/tdigest_double_merge_k.sqlx"},
+  {name: "frequent_strings", build: "fi/sqlx/frequent_strings_sketch_build.sqlx", merge: "fi/sqlx/frequent_strings_sketch_merge.sqlx"}
+];
+
+// non-aggregate parameters that cannot be NULL
+const requiredParams = {lg_max_map_size: 10};
+
+function parseArgs(argv) {
+  const options = {rows: 1000000, distinct: 100000, partitions: 16, fanIn: 16, sketches: 1000, filter: null};
+  for (let i = 0; i < argv.length; i += 2) {
+    const name = argv[i].replace(/^--/, "").replace(/-(.)/g, (_, c) => c.toUpperCase());
+    if (!(name in options) || i + 1 >= argv.length) throw new Error("unknown option or missing value: " + argv[i]);
+    options[name] = name === "filter" ? argv[i + 1] : Number(argv[i + 1]);
+  }
+  return options;
+}
+
+// xorshift64*, so that every run sees the same data
+function random(seed) {
+  let x = BigInt.asUintN(64, BigInt(seed) * 0x9E3779B97F4A7C15n + 1n);
+  return () => {
+    x ^= x >> 12n;
+    x = BigInt.asUintN(64, x ^ (x << 25n));
+    x ^= x >> 27n;
+    return Number(BigInt.asUintN(64, x * 0x2545F4914F6CDD1Dn) >> 11n) / 2 ** 53;
+  };
+}
+
+// splits "name TYPE" declarations at the top level, ignoring commas inside STRUCT<...>
+function splitDeclarations(text) {
+  const result = [];
+  let depth = 0;
+  let start = 0;
+  for (let i = 0; i < text.length; i++) {
+    if (text[i] === "<") depth++;
+    else if (text[i] === ">") depth--;
+    else if (text[i] === "," && depth === 0) {
+      result.push(text.slice(start, i).trim());
+      start = i + 1;
+    }
+  }
+  result.push(text.slice(start).trim());
+  return result;
+}
+
+// the signature and the JavaScript code of an aggregate function in a sqlx file
+function parseSqlx(file) {
+  const sqlx = readFileSync(path.join(root, file), "utf8");
+  const signature = sqlx.match(/AGGREGATE FUNCTION \$\{self\(\)\}\((.*)\)\s*\n/);
+  const code = sqlx.match(/AS R"""\n([\s\S]*)"""/);
+  if (signature == null || code == null) throw new Error(file + " is not a JavaScript aggregate function");
+  const args = [];
+  let param = null;
+  for (const declaration of splitDeclarations(signature[1])) {
+    const [name, ...type] = declaration.split(/\s+/);
+    const notAggregate = declaration.endsWith("NOT AGGREGATE");
+    const typeText = type.join(" ").replace(/\s*NOT AGGREGATE$/, "");
+    if (notAggregate) param = {name: name, type: typeText};
+    else args.push({name: name, type: typeText});
+  }
+  return {args: args, param: param, code: code[1]};
+}
+
+// NULL parameters to use the defaults, except the ones that are required
+function paramValue(param) {
+  if (param == null) return undefined;
+  const struct = param.type.match(/^STRUCT<(.*)>$/);
+  if (struct == null) return requiredParams[param.name] ?? null;
+  const value = {};
+  for (const field of splitDeclarations(struct[1])) {
+    const name = field.split(/\s+/)[0];
+    value[name] = requiredParams[name] ?? null;
+  }
+  return value;
+}
+
+// loads the code of a sqlx file as an ES module importing the modules from this repository
+// the Module instance is exported in addition to read its heap stats
+async function loadUdaf(file, dir) {
+  const {args, param, code} = parseSqlx(file);
+  const moduleDir = pathToFileURL(path.join(root, path.dirname(path.dirname(file)))).href;
+  const source = code.replaceAll("${dataform.projectConfig.vars.jsBucket}", moduleDir) +
+    "\nexport function replayModule() { return Module; }\n";
+  const target = path.join(dir, path.basename(file, ".sqlx") + ".mjs");
+  writeFileSync(target, source);
+  const udaf = await import(pathToFileURL(target).href);
+  return {udaf: udaf, args: args, param: paramValue(param)};
+}
+
+// a row of generated values for the argument types, the first argument is the key
+function rowGenerator(args, options, seed) {
+  const next = random(seed);
+  return () => {
+    const key = Math.floor(next() * options.distinct);
+    return args.map((arg, i) => {
+      switch (arg.type) {
+        case "STRING": return "item" + key;
+        case "INT64": return i === 0 ? BigInt(key) : BigInt(1 + key % 10);
+        case "FLOAT64": return next() * 1000;
+        default: throw new Error("no generator for " + arg.type);
+      }
+    });
+  };
+}
+
+// the state as it arrives at another worker
+function transfer(udaf, state) {
+  return udaf.deserialize(structuredClone(udaf.serialize(state)));
+}
+
+function ms(start) {
+  return Number(process.hrtime.bigint() - start) / 1e6;
+}
+
+// runs the full lifecycle over rows split into partitions, returns the result and the metrics
+function replay(loaded, rows, options) {
+  const {udaf, param} = loaded;
+  const Module = udaf.replayModule();
+  const partitions = Math.max(1, Math.min(options.partitions, rows.length));
+  const perPartition = Math.ceil(rows.length / partitions);
+
+  const start = process.hrtime.bigint();
+  let states = [];
+  let stateBytes = 0;
+  let maxStateBytes = 0;
+  for (let p = 0; p < partitions; p++) {
+    const state = udaf.initialState(param);
+    const end = Math.min(rows.length, (p + 1) * perPartition);
+    for (let i = p * perPartition; i < end; i++) udaf.aggregate(state, ...rows[i]);
+    states.push(state);
+  }
+  const aggregateMs = ms(start);
+
+  const mergeStart = process.hrtime.bigint();
+  const size = (state) => state.serialized == null ? 0 : state.serialized.length;
+  states = states.map((state) => {
+    const transferred = transfer(udaf, state);
+    stateBytes += size(transferred);
+    maxStateBytes = Math.max(maxStateBytes, size(transferred));
+    return transferred;
+  });
+  const fanIn = Math.max(2, options.fanIn);
+  let merges = 0;
+  while (states.length > 1) {
+    const next = [];
+    for (let i = 0; i < states.length; i += fanIn) {
+      const group = states.slice(i, i + fanIn);
+      const state = group[0];
+      for (let j = 1; j < group.length; j++) {
+        udaf.merge(state, group[j]);
+        merges++;
+      }
+      next.push(states.length > fanIn ? transfer(udaf, state) : state);
+    }
+    states = next;
+  }
+  const result = udaf.finalize(states[0]);
+  const mergeMs = ms(mergeStart);
+  const totalMs = ms(start);
+
+  const heap = Module.getHeapStats();
+  const stats = Module.getStats();
+  return {
+    result: result,
+    metrics: {
+      rows: rows.length,
+      partitions: partitions,
+      merges: merges,
+      aggregate_ms: Number(aggregateMs.toFixed(2)),
+      merge_ms: Number(mergeMs.toFixed(2)),
+      total_ms: Number(totalMs.toFixed(2)),
+      rows_per_sec: Math.round(rows.length / (totalMs / 1000)),
+      state_bytes: stateBytes,
+      max_state_bytes: maxStateBytes,
+      output_bytes: result == null ? 0 : result.length,
+      heap_size: heap.heapSize,
+      heap_peak_footprint_bytes: heap.peakFootprintBytes,
+      heap_live_bytes: heap.liveBytes,
+      op_stats: stats.enabled ? stats : undefined
+    }
+  };
+}
+
+const options = parseArgs(process.argv.slice(2));
+const dir = mkdtempSync(path.join(tmpdir(), "udaf_replay_"));
+try {
+  for (const family of families) {
+    if (options.filter != null && !family.name.includes(options.filter)) continue;
+    const build = await loadUdaf(family.build, dir);
+    const rows = [];
+    const nextRow = rowGenerator(build.args, options, 1);
+    for (let i = 0; i < options.rows; i++) rows.push(nextRow());
+    build.udaf.replayModule().resetStats();
+    const built = replay(build, rows, options);
+    console.log(JSON.stringify({family: family.name, function: path.basename(family.build, ".sqlx"), ...built.metrics}));
+
+    if (family.merge == null) continue;
+    const merge = await loadUdaf(family.merge, dir);
+    // input sketches built from consecutive slices of the generated rows
+    const sketches = [];
+    const slice = Math.max(1, Math.floor(rows.length / options.sketches));
+    for (let i = 0; i < options.sketches; i++) {
+      const state = build.udaf.initialState(build.param);
+      for (let j = 0; j < slice; j++) build.udaf.aggregate(state, ...rows[(i * slice + j) % rows.length]);
+      sketches.push([build.udaf.finalize(state)]);
+    }
+    merge.udaf.replayModule().resetStats();
+    const merged = replay(merge, sketches, options);
+    console.log(JSON.stringify({family: family.name, function: path.basename(family.merge, ".sqlx"), ...merged.metrics}));
+  }
+} finally {
+  rmSync(dir, {recursive: true, force: true});
+}
@@ -0,0 +1,412 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+// Builds one sketch from local CSV or newline-delimited files using all cores.
+// Input files are split into chunks at line boundaries, every worker thread builds
+// its own sketch from the chunks it takes, and the per-thread sketches are merged
+// with the same union types as the aggregate functions. The output file holds the
+// serialized sketch exactly as the corresponding aggregate function returns it.
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <theta_sketch.hpp>
+#include <theta_union.hpp>
+#include <hll.hpp>
+#include <cpc_sketch.hpp>
+#include <cpc_union.hpp>
+#include <kll_sketch.hpp>
+
+#include "hll_register_union.hpp"
+#include "tuple_sketch_int64.hpp"
+
+using kll_sketch_float = datasketches::kll_sketch<float>;
+using bytes = std::vector<uint8_t>;
+
+struct builder_config {
+  std::string family;
+  std::string key_type = "string"; // string or int64, selects the hashing of the key column
+  size_t key_column = 0;
+  size_t value_column = 1;         // tuple summaries
+  char delimiter = ',';
+  bool header = false;
+  size_t threads = std::thread::hardware_concurrency();
+  size_t chunk_bytes = 64 << 20;
+  int lg_k = -1;                   // family default if negative
+  uint64_t seed = datasketches::DEFAULT_SEED;
+  float p = 1;
+  std::string tgt_type;
+  std::string mode;
+  uint16_t k = datasketches::kll_constants::DEFAULT_K;
+  std::string output;
+  std::vector<std::string> inputs;
+};
+
+// rows of a file whose first byte is in [begin, end)
+struct chunk {
+  size_t file;
+  uint64_t begin;
+  uint64_t end;
+};
+
+struct worker_stats {
+  uint64_t rows = 0;
+  uint64_t skipped = 0; // empty key (NULL) rows
+};
+
+static std::vector<chunk> make_chunks(const builder_config& config) {
+  std::vector<chunk> chunks;
+  for (size_t i = 0; i < config.inputs.size(); ++i) {
+    std::ifstream is(config.inputs[i], std::ios::binary | std::ios::ate);
+    if (!is) throw std::runtime_error("cannot open " + config.inputs[i]);
+    const uint64_t size = is.tellg();
+    for (uint64_t begin = 0; begin < size; begin += config.chunk_bytes) {
+      chunks.push_back(chunk{i, begin, std::min<uint64_t>(begin + config.chunk_bytes, size)});
+    }
+  }
+  return chunks;
+}
+
+static std::string_view get_field(std::string_view line, size_t index, char delimiter) {
+  size_t start = 0;
+  for (size_t i = 0; i < index; ++i) {
+    start = line.find(delimiter, start);
+    if (start == std::string_view::npos) return std::string_view();
+    ++start;
+  }
+  const size_t end = line.find(delimiter, start);
+  return line.substr(start, end == std::string_view::npos ? std::string_view::npos : end - start);
+}
+
+static int64_t parse_int64(std::string_view field) {
+  const std::string str(field);
+  char* end = nullptr;
+  errno = 0;
+  const long long value = std::strtoll(str.c_str(), &end, 10);
+  if (errno != 0 || end != str.c_str() + str.size()) throw std::invalid_argument("invalid INT64 value '" + str + "'");
+  return value;
+}
+
+// parsed as a double first like a FLOAT64 passed to the aggregate function, then narrowed
+static float parse_float(std::string_view field) {
+  const std::string str(field);
+  char* end = nullptr;
+  const double value = std::strtod(str.c_str(), &end);
+  if (end != str.c_str() + str.size()) throw std::invalid_argument("invalid FLOAT64 value '" + str + "'");
+  return static_cast<float>(value);
+}
+
+// calls row(line) for every line owned by the chunk, without the line terminator
+template<typename Row>
+void for_each_line(const builder_config& config, const chunk& c, Row&& row) {
+  std::ifstream is(config.inputs[c.file], std::ios::binary);
+  if (!is) throw std::runtime_error("cannot open " + config.inputs[c.file]);
+  uint64_t pos = c.begin;
+  std::string line;
+  if (c.begin > 0) {
+    // the line crossing the chunk start belongs to the previous chunk
+    is.seekg(c.begin - 1);
+    std::getline(is, line);
+    pos += line.size();
+  } else if (config.header) {
+    std::getline(is, line);
+    pos += line.size() + 1;
+  }
+  while (pos < c.end && std::getline(is, line)) {
+    pos += line.size() + 1;
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    row(std::string_view(line));
+  }
+}
+
+/**
+ * Everything the builder needs to know about a sketch family.
+ * make() creates an empty sketch, update() adds one input line,
+ * serialize() writes a single sketch and merge() the union of several,
+ * both in the format of the aggregate function's result.
+ */
+template<typename Sketch>
+struct family_ops {
+  std::function<Sketch()> make;
+  std::function<bool(Sketch&, std::string_view)> update; // false if the row was skipped
+  std::function<bytes(const Sketch&)> serialize;
+  std::function<bytes(std::vector<Sketch>&)> merge;
+};
+
+struct build_result {
+  bytes serialized;
+  worker_stats stats;
+  size_t threads;
+  double build_seconds;
+  double merge_seconds;
+};
+
+template<typename Sketch>
+build_result build(const builder_config& config, const family_ops<Sketch>& ops) {
+  const auto chunks = make_chunks(config);
+  const size_t num_threads = std::max<size_t>(1, std::min(config.threads, chunks.size()));
+  std::vector<Sketch> sketches;
+  for (size_t i = 0; i < num_threads; ++i) sketches.push_back(ops.make());
+  std::vector<worker_stats> stats(num_threads);
+  std::vector<std::exception_ptr> errors(num_threads);
+  std::atomic<size_t> next_chunk(0);
+
+  const auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+  for (size_t t = 0; t < num_threads; ++t) {
+    workers.emplace_back([&, t]() {
+      try {
+        for (size_t i = next_chunk++; i < chunks.size(); i = next_chunk++) {
+          for_each_line(config, chunks[i], [&](std::string_view line) {
+            if (ops.update(sketches[t], line)) ++stats[t].rows;
+            else ++stats[t].skipped;
+          });
+        }
+      } catch (...) {
+        errors[t] = std::current_exception();
+        next_chunk = chunks.size();
+      }
+    });
+  }
+  for (auto& worker: workers) worker.join();
+  for (const auto& error: errors) if (error) std::rethrow_exception(error);
+  const auto built = std::chrono::steady_clock::now();
+
+  build_result result;
+  // a single sketch is returned as is, like an aggregate function that ran on one worker
+  result.serialized = sketches.size() == 1 ? ops.serialize(sketches.front()) : ops.merge(sketches);
+  result.threads = num_threads;
+  result.build_seconds = std::chrono::duration<double>(built - start).count();
+  result.merge_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - built).count();
+  for (const auto& s: stats) {
+    result.stats.rows += s.rows;
+    result.stats.skipped += s.skipped;
+  }
+  return result;
+}
+
+template<typename Sketch>
+bool update_key(const builder_config& config, Sketch& sketch, std::string_view line) {
+  const auto key = get_field(line, config.key_column, config.delimiter);
+  if (key.empty()) return false;
+  if (config.key_type == "int64") sketch.update(static_cast<uint64_t>(parse_int64(key)));
+  else sketch.update(key.data(), key.size());
+  return true;
+}
+
+static build_result build_theta(const builder_config& config) {
+  const uint8_t lg_k = config.lg_k < 0 ? datasketches::theta_constants::DEFAULT_LG_K : config.lg_k;
+  family_ops<datasketches::update_theta_sketch> ops;
+  ops.make = [&]() {
+    return datasketches::update_theta_sketch::builder().set_lg_k(lg_k).set_seed(config.seed).set_p(config.p).build();
+  };
+  ops.update = [&](datasketches::update_theta_sketch& sketch, std::string_view line) { return update_key(config, sketch, line); };
+  ops.serialize = [](const datasketches::update_theta_sketch& sketch) {
+    const auto b = sketch.compact().serialize_compressed();
+    return bytes(b.begin(), b.end());
+  };
+  ops.merge = [&](std::vector<datasketches::update_theta_sketch>& sketches) {
+    auto u = datasketches::theta_union::builder().set_lg_k(lg_k).set_seed(config.seed).build();
+    for (const auto& sketch: sketches) u.update(sketch);
+    const auto b = u.get_result().serialize_compressed();
+    return bytes(b.begin(), b.end());
+  };
+  return build(config, ops);
+}
+
+static datasketches::target_hll_type parse_tgt_type(const std::string& tgt_type_str) {
+  if (tgt_type_str == "" || tgt_type_str == "HLL_4") return datasketches::HLL_4;
+  if (tgt_type_str == "HLL_6") return datasketches::HLL_6;
+  if (tgt_type_str == "HLL_8") return datasketches::HLL_8;
+  throw std::invalid_argument("unrecognized HLL target type " + tgt_type_str);
+}
+
+static build_result build_hll(const builder_config& config) {
+  const uint8_t lg_k = config.lg_k < 0 ? 12 : config.lg_k;
+  const auto tgt_type = parse_tgt_type(config.tgt_type);
+  family_ops<datasketches::hll_sketch> ops;
+  ops.make = [&]() { return datasketches::hll_sketch(lg_k, tgt_type); };
+  ops.update = [&](datasketches::hll_sketch& sketch, std::string_view line) { return update_key(config, sketch, line); };
+  ops.serialize = [](const datasketches::hll_sketch& sketch) {
+    const auto b = sketch.serialize_compact();
+    return bytes(b.begin(), b.end());
+  };
+  ops.merge = [&](std::vector<datasketches::hll_sketch>& sketches) {
+    hll_register_union u(lg_k);
+    for (const auto& sketch: sketches) u.update(sketch);
+    const auto b = u.get_result(tgt_type).serialize_compact();
+    return bytes(b.begin(), b.end());
+  };
+  return build(config, ops);
+}
+
+static build_result build_cpc(const builder_config& config) {
+  const uint8_t lg_k = config.lg_k < 0 ? datasketches::cpc_constants::DEFAULT_LG_K : config.lg_k;
+  family_ops<datasketches::cpc_sketch> ops;
+  ops.make = [&]() { return datasketches::cpc_sketch(lg_k, config.seed); };
+  ops.update = [&](datasketches::cpc_sketch& sketch, std::string_view line) { return update_key(config, sketch, line); };
+  ops.serialize = [](const datasketches::cpc_sketch& sketch) {
+    const auto b = sketch.serialize();
+    return bytes(b.begin(), b.end());
+  };
+  ops.merge = [&](std::vector<datasketches::cpc_sketch>& sketches) {
+    datasketches::cpc_union u(lg_k, config.seed);
+    for (const auto& sketch: sketches) u.update(sketch);
+    const auto b = u.get_result().serialize();
+    return bytes(b.begin(), b.end());
+  };
+  return build(config, ops);
+}
+
+static build_result build_kll(const builder_config& config) {
+  family_ops<kll_sketch_float> ops;
+  ops.make = [&]() { return kll_sketch_float(config.k); };
+  ops.update = [&](kll_sketch_float& sketch, std::string_view line) {
+    const auto value = get_field(line, config.key_column, config.delimiter);
+    if (value.empty()) return false;
+    sketch.update(parse_float(value));
+    return true;
+  };
+  ops.serialize = [](const kll_sketch_float& sketch) {
+    const auto b = sketch.serialize();
+    return bytes(b.begin(), b.end());
+  };
+  ops.merge = [&](std::vector<kll_sketch_float>& sketches) {
+    kll_sketch_float result(config.k);
+    for (const auto& sketch: sketches) result.merge(sketch);
+    const auto b = result.serialize();
+    return bytes(b.begin(), b.end());
+  };
+  return build(config, ops);
+}
+
+static build_result build_tuple(const builder_config& config) {
+  const uint8_t lg_k = config.lg_k < 0 ? datasketches::theta_constants::DEFAULT_LG_K : config.lg_k;
+  const tuple_mode mode = convert_mode(config.mode);
+  family_ops<update_tuple_sketch_int64> ops;
+  ops.make = [&]() { return update_tuple_sketch_int64(lg_k, config.seed, config.p, mode); };
+  ops.update = [&](update_tuple_sketch_int64& sketch, std::string_view line) {
+    const auto key = get_field(line, config.key_column, config.delimiter);
+    const auto value = get_field(line, config.value_column, config.delimiter);
+    if (key.empty()) return false;
+    const Update update = value.empty() ? 0 : static_cast<Update>(parse_int64(value));
+    if (config.key_type == "int64") sketch.update(static_cast<uint64_t>(parse_int64(key)), update);
+    else sketch.update(std::string(key), update);
+    return true;
+  };
+  ops.serialize = [](const update_tuple_sketch_int64& sketch) {
+    const auto b = sketch.compact().serialize();
+    return bytes(b.begin(), b.end());
+  };
+  ops.merge = [&](std::vector<update_tuple_sketch_int64>& sketches) {
+    tuple_union_int64 u(lg_k, config.seed, mode);
+    for (const auto& sketch: sketches) u.update(sketch);
+    const auto b = u.get_result().serialize();
+    return bytes(b.begin(), b.end());
+  };
+  return build(config, ops);
+}
+
+static void usage(const char* name) {
+  std::cerr << "usage: " << name << " --family theta|hll|cpc|kll|tuple --output FILE [options] INPUT...\n"
+    "  --threads N          worker threads (default: number of cores)\n"
+    "  --key_type T         string or int64, as in the _string and _int64 aggregate functions (default string)\n"
+    "  --column N           zero-based key column, or the value column for kll (default 0)\n"
+    "  --value_column N     zero-based summary column for tuple (default 1)\n"
+    "  --delimiter C        column delimiter, quoting is not supported (default ,)\n"
+    "  --header             skip the first line of every file\n"
+    "  --lg_k N --seed N --p F --type HLL_4|HLL_6|HLL_8 --mode SUM|MIN|MAX|ONE --k N\n"
+    "                       sketch parameters, defaults as in the aggregate functions\n"
+    "Rows with an empty key are skipped like NULL keys. A throughput report is printed as one JSON line." << std::endl;
+  std::exit(1);
+}
+
+int main(int argc, char** argv) {
+  builder_config config;
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    if (arg == "--header") { config.header = true; continue; }
+    if (arg.rfind("--", 0) != 0) { config.inputs.push_back(arg); continue; }
+    if (i + 1 >= argc) usage(argv[0]);
+    const char* value = argv[++i];
+    if (arg == "--family") config.family = value;
+    else if (arg == "--output") config.output = value;
+    else if (arg == "--threads") config.threads = std::strtoull(value, nullptr, 10);
+    else if (arg == "--key_type") config.key_type = value;
+    else if (arg == "--column") config.key_column = std::strtoull(value, nullptr, 10);
+    else if (arg == "--value_column") config.value_column = std::strtoull(value, nullptr, 10);
+    else if (arg == "--delimiter") config.delimiter = value[0];
+    else if (arg == "--lg_k") config.lg_k = std::atoi(value);
+    else if (arg == "--seed") config.seed = std::strtoull(value, nullptr, 10);
+    else if (arg == "--p") config.p = std::strtof(value, nullptr);
+    else if (arg == "--type") config.tgt_type = value;
+    else if (arg == "--mode") config.mode = value;
+    else if (arg == "--k") config.k = std::atoi(value);
+    else usage(argv[0]);
+  }
+  if (config.family.empty() || config.output.empty() || config.inputs.empty() || config.threads == 0
+      || config.delimiter == '\0' || (config.key_type != "string" && config.key_type != "int64")) usage(argv[0]);
+
+  const std::vector<std::pair<std::string, std::function<build_result(const builder_config&)>>> families = {
+    {"theta", build_theta},
+    {"hll", build_hll},
+    {"cpc", build_cpc},
+    {"kll", build_kll},
+    {"tuple", build_tuple}
+  };
+  try {
+    for (const auto& family: families) {
+      if (family.first != config.family) continue;
+      const auto result = family.second(config);
+      std::ofstream os(config.output, std::ios::binary);
+      os.write(reinterpret_cast<const char*>(result.serialized.data()), result.serialized.size());
+      if (!os) throw std::runtime_error("cannot write " + config.output);
+
+      uint64_t input_bytes = 0;
+      for (const auto& input: config.inputs) input_bytes += std::ifstream(input, std::ios::binary | std::ios::ate).tellg();
+      const double seconds = result.build_seconds + result.merge_seconds;
+      std::printf(
+        "{\"family\":\"%s\",\"files\":%zu,\"threads\":%zu,\"rows\":%llu,\"skipped\":%llu,\"input_bytes\":%llu,"
+        "\"output_bytes\":%zu,\"build_seconds\":%.3f,\"merge_seconds\":%.3f,\"rows_per_second\":%.0f,\"mb_per_second\":%.1f}\n",
+        config.family.c_str(), config.inputs.size(), result.threads,
+        static_cast<unsigned long long>(result.stats.rows), static_cast<unsigned long long>(result.stats.skipped),
+        static_cast<unsigned long long>(input_bytes), result.serialized.size(), result.build_seconds, result.merge_seconds,
+        result.stats.rows / seconds, input_bytes / seconds / (1 << 20)
+      );
+      return 0;
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+  usage(argv[0]);
+  return 1;
+}
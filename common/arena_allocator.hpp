@@ -0,0 +1,184 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#ifndef ARENA_ALLOCATOR_HPP_
+#define ARENA_ALLOCATOR_HPP_
+
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Bump-pointer memory arena.
+ * Memory is taken from the heap in chunks of growing size and is returned
+ * all at once when the arena is destroyed, so a sketch that lives in its own arena
+ * leaves no fragments behind no matter how many times its internal arrays were resized.
+ * A deallocated block at the top of the current chunk is given back to the chunk,
+ * any other block is kept in a free list of its size and reused by the next allocation
+ * of the same size, such as the next buffer of a container that grows and shrinks.
+ * The first chunk is small, so that short-lived objects with an arena of their own
+ * (for example temporaries that the library constructs with a default allocator) stay cheap.
+ * Totals over all live arenas are kept for heap statistics.
+ */
+class arena {
+public:
+  static constexpr size_t MIN_CHUNK_SIZE = 256;
+  static constexpr size_t MAX_CHUNK_SIZE = 1 << 20;
+  static constexpr size_t ALIGNMENT = alignof(std::max_align_t);
+
+  struct stats {
+    size_t num_arenas;
+    size_t reserved_bytes;
+    size_t used_bytes;
+    size_t peak_reserved_bytes;
+  };
+
+  arena(): next_chunk_size_(MIN_CHUNK_SIZE), top_(nullptr), end_(nullptr), reserved_(0), used_(0) {
+    ++totals().num_arenas;
+  }
+
+  ~arena() {
+    for (void* chunk: chunks_) std::free(chunk);
+    totals().reserved_bytes -= reserved_;
+    totals().used_bytes -= used_;
+    --totals().num_arenas;
+  }
+
+  arena(const arena&) = delete;
+  arena& operator=(const arena&) = delete;
+
+  void* allocate(size_t size) {
+    size = align(size);
+    used_ += size;
+    totals().used_bytes += size;
+    const auto it = free_lists_.find(size);
+    if (it != free_lists_.end() && it->second != nullptr) {
+      void* ptr = it->second;
+      it->second = *static_cast<void**>(ptr);
+      return ptr;
+    }
+    if (static_cast<size_t>(end_ - top_) < size) add_chunk(size);
+    void* ptr = top_;
+    top_ += size;
+    return ptr;
+  }
+
+  void deallocate(void* ptr, size_t size) {
+    size = align(size);
+    used_ -= size;
+    totals().used_bytes -= size;
+    if (static_cast<char*>(ptr) + size == top_) {
+      top_ = static_cast<char*>(ptr);
+      return;
+    }
+    // the free block itself holds the link to the next free block of the same size
+    void*& head = free_lists_[size];
+    *static_cast<void**>(ptr) = head;
+    head = ptr;
+  }
+
+  size_t get_reserved_bytes() const { return reserved_; }
+  size_t get_used_bytes() const { return used_; }
+
+  static const stats& get_totals() { return totals(); }
+
+private:
+  std::vector<void*> chunks_;
+  std::unordered_map<size_t, void*> free_lists_;
+  size_t next_chunk_size_;
+  char* top_;
+  char* end_;
+  size_t reserved_;
+  size_t used_;
+
+  // at least one alignment unit, so that every block can hold a free list link
+  static size_t align(size_t size) {
+    return std::max((size + ALIGNMENT - 1) & ~(ALIGNMENT - 1), ALIGNMENT);
+  }
+
+  void add_chunk(size_t min_size) {
+    const size_t size = std::max(next_chunk_size_, min_size);
+    void* chunk = std::malloc(size);
+    if (chunk == nullptr) throw std::bad_alloc();
+    chunks_.push_back(chunk);
+    top_ = static_cast<char*>(chunk);
+    end_ = top_ + size;
+    reserved_ += size;
+    totals().reserved_bytes += size;
+    if (totals().reserved_bytes > totals().peak_reserved_bytes) totals().peak_reserved_bytes = totals().reserved_bytes;
+    next_chunk_size_ = std::min(next_chunk_size_ * 2, MAX_CHUNK_SIZE);
+  }
+
+  static stats& totals() {
+    static stats s = {0, 0, 0, 0};
+    return s;
+  }
+};
+
+/**
+ * Standard allocator over a shared arena.
+ * A default-constructed allocator creates a new arena, so every sketch constructed
+ * or deserialized with a default allocator gets its own arena, which is released
+ * together with the last object that uses it.
+ * Copies and rebound copies share the arena of the original.
+ */
+template<typename T>
+class arena_allocator {
+public:
+  using value_type = T;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  arena_allocator(): arena_(std::make_shared<arena>()) {}
+
+  template<typename U>
+  arena_allocator(const arena_allocator<U>& other): arena_(other.get_arena()) {}
+
+  T* allocate(size_t n) {
+    return static_cast<T*>(arena_->allocate(n * sizeof(T)));
+  }
+
+  void deallocate(T* ptr, size_t n) {
+    arena_->deallocate(ptr, n * sizeof(T));
+  }
+
+  const std::shared_ptr<arena>& get_arena() const { return arena_; }
+
+private:
+  std::shared_ptr<arena> arena_;
+};
+
+template<typename T, typename U>
+bool operator==(const arena_allocator<T>& a, const arena_allocator<U>& b) {
+  return a.get_arena() == b.get_arena();
+}
+
+template<typename T, typename U>
+bool operator!=(const arena_allocator<T>& a, const arena_allocator<U>& b) {
+  return !(a == b);
+}
+
+#endif
@@ -0,0 +1,86 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#ifndef BATCH_UPDATE_HPP_
+#define BATCH_UPDATE_HPP_
+
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Read-only view of variable-length items packed by the caller into the WASM heap
+ * in one buffer: an array of count + 1 uint32 offsets and a contiguous data region.
+ * Item i occupies bytes [offsets[i], offsets[i + 1]) of the data region.
+ */
+class packed_items {
+public:
+  packed_items(intptr_t offsets, intptr_t data, size_t count):
+    offsets_(reinterpret_cast<const uint32_t*>(offsets)),
+    data_(reinterpret_cast<const char*>(data)),
+    count_(count) {}
+
+  size_t size() const { return count_; }
+  const char* item_data(size_t i) const { return data_ + offsets_[i]; }
+  size_t item_size(size_t i) const { return offsets_[i + 1] - offsets_[i]; }
+  size_t total_size() const { return offsets_[count_] - offsets_[0]; }
+
+private:
+  const uint32_t* offsets_;
+  const char* data_;
+  size_t count_;
+};
+
+/**
+ * Updates the given sketch with every item of a packed batch.
+ * Empty items are skipped to match update(const std::string&).
+ */
+template<typename Sketch>
+void update_string_batch(Sketch& sketch, const packed_items& items) {
+  for (size_t i = 0; i < items.size(); ++i) {
+    const size_t size = items.item_size(i);
+    if (size > 0) sketch.update(items.item_data(i), size);
+  }
+}
+
+/**
+ * Updates the given sketch with a contiguous array of 64-bit values.
+ */
+template<typename Sketch>
+void update_int64_batch(Sketch& sketch, const uint64_t* values, size_t count) {
+  for (size_t i = 0; i < count; ++i) sketch.update(values[i]);
+}
+
+/**
+ * Updates the given union with every serialized sketch of a packed batch.
+ * Sketches are read one at a time, so only one of them is materialized at any moment.
+ * Empty items are skipped like NULL inputs.
+ * @param u union to update
+ * @param items packed serialized sketches
+ * @param read function that wraps or deserializes one sketch given its bytes and size
+ */
+template<typename Union, typename Read>
+void update_union_packed(Union& u, const packed_items& items, Read&& read) {
+  for (size_t i = 0; i < items.size(); ++i) {
+    const size_t size = items.item_size(i);
+    if (size > 0) u.update(read(items.item_data(i), size));
+  }
+}
+
+#endif
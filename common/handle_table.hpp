@@ -0,0 +1,69 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#ifndef HANDLE_TABLE_HPP_
+#define HANDLE_TABLE_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Objects owned on the C++ side and referred to from JavaScript by integer handles.
+ * This backs the extern "C" entry points, which take plain integers and heap pointers
+ * instead of embind class wrappers. Handles are slot numbers starting from 1,
+ * so 0 is never valid. Slots of destroyed objects are reused.
+ */
+template<typename T>
+class handle_table {
+public:
+  template<typename... Args>
+  uint32_t create(Args&&... args) {
+    auto object = std::make_unique<T>(std::forward<Args>(args)...);
+    if (free_.empty()) {
+      objects_.push_back(std::move(object));
+      return static_cast<uint32_t>(objects_.size());
+    }
+    const uint32_t handle = free_.back();
+    free_.pop_back();
+    objects_[handle - 1] = std::move(object);
+    return handle;
+  }
+
+  T& get(uint32_t handle) {
+    if (handle == 0 || handle > objects_.size() || !objects_[handle - 1]) throw std::invalid_argument("invalid handle " + std::to_string(handle));
+    return *objects_[handle - 1];
+  }
+
+  void destroy(uint32_t handle) {
+    get(handle);
+    objects_[handle - 1].reset();
+    free_.push_back(handle);
+  }
+
+private:
+  std::vector<std::unique_ptr<T>> objects_;
+  std::vector<uint32_t> free_;
+};
+
+#endif
@@ -0,0 +1,55 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#ifndef HEAP_STATS_HPP_
+#define HEAP_STATS_HPP_
+
+#include <malloc.h>
+#include <emscripten/bind.h>
+#include <emscripten/heap.h>
+
+#include "arena_allocator.hpp"
+
+/**
+ * Returns a JS object with the state of the WASM heap:
+ * heapSize - current size of the WASM memory (it never shrinks, so it is also its peak)
+ * liveBytes - bytes currently allocated by malloc
+ * peakFootprintBytes - highest memory obtained by malloc from the heap so far, including freed blocks
+ *   that malloc kept, so it is an upper bound of the peak of liveBytes
+ * arenas, arenaReservedBytes, arenaUsedBytes, arenaPeakReservedBytes, arenaUtilization -
+ *   totals over live sketch arenas (all zero unless built with USE_ARENA_ALLOCATOR)
+ */
+inline emscripten::val get_heap_stats() {
+  const struct mallinfo info = mallinfo();
+  const auto& arenas = arena::get_totals();
+  auto stats = emscripten::val::object();
+  stats.set("heapSize", static_cast<double>(emscripten_get_heap_size()));
+  stats.set("liveBytes", static_cast<double>(info.uordblks));
+  stats.set("peakFootprintBytes", static_cast<double>(info.usmblks));
+  stats.set("arenas", static_cast<double>(arenas.num_arenas));
+  stats.set("arenaReservedBytes", static_cast<double>(arenas.reserved_bytes));
+  stats.set("arenaUsedBytes", static_cast<double>(arenas.used_bytes));
+  stats.set("arenaPeakReservedBytes", static_cast<double>(arenas.peak_reserved_bytes));
+  stats.set("arenaUtilization", arenas.reserved_bytes == 0 ? 0.0 :
+    static_cast<double>(arenas.used_bytes) / arenas.reserved_bytes);
+  return stats;
+}
+
+#endif
@@ -0,0 +1,187 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef JACCARD_MATRIX_HPP_
+#define JACCARD_MATRIX_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#if !defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_PTHREADS__)
+#define JACCARD_MATRIX_THREADS 1
+#include <atomic>
+#include <exception>
+#include <thread>
+#endif
+
+#include <bounds_on_ratios_in_sampled_sets.hpp>
+#include <theta_constants.hpp>
+
+/**
+ * Jaccard similarity of every pair of N theta or tuple sketches.
+ * The hashes of each sketch are extracted and sorted once, and every pair is
+ * evaluated by merge-joining the two sorted arrays below the smaller theta.
+ * The results are the same as from Jaccard::jaccard(a, b), which builds a union
+ * and an intersection per pair: with lg_k large enough for both sketches
+ * the union is all hashes below the smaller theta, and the intersection is
+ * the common hashes among them.
+ * The only exception is a pair with more hashes than the largest union can hold
+ * (2^26), which is passed to Jaccard::jaccard.
+ * @tparam Sketch wrapped compact theta or tuple sketch, must outlive the matrix
+ * @tparam Jaccard theta_jaccard_similarity or tuple_jaccard_similarity
+ */
+template<typename Sketch, typename Jaccard>
+class jaccard_matrix {
+public:
+  /**
+   * Extracts the sorted hashes of the given sketches.
+   * @param sketches sketches to compare
+   * @param seed seed the sketches were built with
+   */
+  jaccard_matrix(const std::vector<Sketch>& sketches, uint64_t seed): sketches_(sketches), seed_(seed) {
+    hashes_.reserve(sketches.size());
+    for (const auto& sketch: sketches) {
+      std::vector<uint64_t> hashes;
+      hashes.reserve(sketch.get_num_retained());
+      for (const auto& entry: sketch) hashes.push_back(key(entry));
+      if (!sketch.is_ordered()) std::sort(hashes.begin(), hashes.end());
+      hashes_.push_back(std::move(hashes));
+    }
+  }
+
+  /**
+   * @return number of values in the upper triangle: 3 per pair of sketches
+   */
+  size_t get_num_values() const {
+    const size_t n = sketches_.size();
+    return n < 2 ? 0 : 3 * n * (n - 1) / 2;
+  }
+
+  /**
+   * Computes the upper triangle of the matrix.
+   * For every pair (i, j) with i < j in row-major order the result holds
+   * the lower bound, the estimate and the upper bound of the Jaccard index.
+   * @param result destination of get_num_values() values
+   * @param num_threads number of threads sharing the rows, ignored in a build without threads
+   */
+  void compute(double* result, size_t num_threads = 1) const {
+    const size_t n = sketches_.size();
+#ifdef JACCARD_MATRIX_THREADS
+    num_threads = std::max<size_t>(1, std::min(num_threads, n));
+    if (num_threads > 1) {
+      // rows get shorter towards the end, so they are taken one at a time
+      std::atomic<size_t> next_row(0);
+      std::vector<std::exception_ptr> errors(num_threads);
+      std::vector<std::thread> workers;
+      for (size_t t = 0; t < num_threads; ++t) {
+        workers.emplace_back([&, t]() {
+          try {
+            for (size_t i = next_row++; i < n; i = next_row++) compute_row(i, result);
+          } catch (...) {
+            errors[t] = std::current_exception();
+            next_row = n;
+          }
+        });
+      }
+      for (auto& worker: workers) worker.join();
+      for (const auto& error: errors) if (error) std::rethrow_exception(error);
+      return;
+    }
+#endif
+    for (size_t i = 0; i < n; ++i) compute_row(i, result);
+  }
+
+  /**
+   * Computes the Jaccard index of one pair.
+   * @param i index of the first sketch
+   * @param j index of the second sketch
+   * @return lower bound, estimate and upper bound
+   */
+  std::array<double, 3> get(size_t i, size_t j) const {
+    const Sketch& a = sketches_[i];
+    const Sketch& b = sketches_[j];
+    if (a.is_empty() && b.is_empty()) return {1, 1, 1};
+    if (a.is_empty() || b.is_empty()) return {0, 0, 0};
+    const auto& hashes_a = hashes_[i];
+    const auto& hashes_b = hashes_[j];
+    if (hashes_a.size() + hashes_b.size() > MAX_UNION_SIZE) return Jaccard::jaccard(a, b, seed_);
+
+    const uint64_t theta = std::min(a.get_theta64(), b.get_theta64());
+    const auto end_a = std::lower_bound(hashes_a.begin(), hashes_a.end(), theta);
+    const auto end_b = std::lower_bound(hashes_b.begin(), hashes_b.end(), theta);
+    uint64_t count_intersection = 0;
+    auto it_a = hashes_a.begin();
+    auto it_b = hashes_b.begin();
+    while (it_a != end_a && it_b != end_b) {
+      if (*it_a < *it_b) {
+        ++it_a;
+      } else if (*it_b < *it_a) {
+        ++it_b;
+      } else {
+        ++count_intersection;
+        ++it_a;
+        ++it_b;
+      }
+    }
+    const uint64_t count_union = (end_a - hashes_a.begin()) + (end_b - hashes_b.begin()) - count_intersection;
+
+    // identical sets
+    if (count_union == hashes_a.size() && count_union == hashes_b.size()
+        && theta == a.get_theta64() && theta == b.get_theta64()) return {1, 1, 1};
+
+    // the bounds of the intersection over the union, both with the same theta
+    if (count_union == 0) return {0, 0.5, 1};
+    const double f = static_cast<double>(theta) / static_cast<double>(datasketches::theta_constants::MAX_THETA);
+    using bounds = datasketches::bounds_on_ratios_in_sampled_sets;
+    return {
+      bounds::lower_bound_for_b_over_a(count_union, count_intersection, f),
+      static_cast<double>(count_intersection) / static_cast<double>(count_union),
+      bounds::upper_bound_for_b_over_a(count_union, count_intersection, f)
+    };
+  }
+
+private:
+  static constexpr size_t MAX_UNION_SIZE = static_cast<size_t>(1) << datasketches::theta_constants::MAX_LG_K;
+
+  const std::vector<Sketch>& sketches_;
+  uint64_t seed_;
+  std::vector<std::vector<uint64_t>> hashes_;
+
+  static uint64_t key(uint64_t hash) { return hash; }
+
+  template<typename Summary>
+  static uint64_t key(const std::pair<uint64_t, Summary>& entry) { return entry.first; }
+
+  // values of row i start after the rows above it: 3 * (i * n - i * (i + 1) / 2)
+  void compute_row(size_t i, double* result) const {
+    const size_t n = sketches_.size();
+    double* ptr = result + 3 * (i * n - i * (i + 1) / 2);
+    for (size_t j = i + 1; j < n; ++j) {
+      const auto values = get(i, j);
+      *ptr++ = values[0];
+      *ptr++ = values[1];
+      *ptr++ = values[2];
+    }
+  }
+};
+
+#endif
@@ -0,0 +1,127 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#ifndef MURMUR_HASH_BATCH_HPP_
+#define MURMUR_HASH_BATCH_HPP_
+
+#include <cstdint>
+#include <cstddef>
+
+#ifdef __wasm_simd128__
+#include <wasm_simd128.h>
+#endif
+
+// MurmurHash3_x64_128 of a single 8-byte key, specialized for the key length
+// used by update(uint64_t) in the sketches (little-endian only, as is WASM).
+// Only the first 64-bit half of the hash is produced since that is what theta and tuple sketches use.
+
+namespace murmur_hash_batch {
+
+static const uint64_t C1 = 0x87c37b91114253d5ULL;
+static const uint64_t C2 = 0x4cf5ad432745937fULL;
+static const uint64_t FMIX1 = 0xff51afd7ed558ccdULL;
+static const uint64_t FMIX2 = 0xc4ceb9fe1a85ec53ULL;
+static const uint64_t KEY_SIZE = 8;
+
+inline uint64_t rotl64(uint64_t x, int r) {
+  return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t fmix64(uint64_t k) {
+  k ^= k >> 33;
+  k *= FMIX1;
+  k ^= k >> 33;
+  k *= FMIX2;
+  k ^= k >> 33;
+  return k;
+}
+
+inline uint64_t hash_int64_h1(uint64_t key, uint64_t seed) {
+  uint64_t h1 = seed;
+  uint64_t h2 = seed;
+  uint64_t k1 = key;
+  k1 *= C1;
+  k1 = rotl64(k1, 31);
+  k1 *= C2;
+  h1 ^= k1;
+  h1 ^= KEY_SIZE;
+  h2 ^= KEY_SIZE;
+  h1 += h2;
+  h2 += h1;
+  h1 = fmix64(h1);
+  h2 = fmix64(h2);
+  return h1 + h2;
+}
+
+#ifdef __wasm_simd128__
+
+inline v128_t rotl64x2(v128_t x, int r) {
+  return wasm_v128_or(wasm_i64x2_shl(x, r), wasm_u64x2_shr(x, 64 - r));
+}
+
+inline v128_t fmix64x2(v128_t k) {
+  k = wasm_v128_xor(k, wasm_u64x2_shr(k, 33));
+  k = wasm_i64x2_mul(k, wasm_i64x2_splat(FMIX1));
+  k = wasm_v128_xor(k, wasm_u64x2_shr(k, 33));
+  k = wasm_i64x2_mul(k, wasm_i64x2_splat(FMIX2));
+  k = wasm_v128_xor(k, wasm_u64x2_shr(k, 33));
+  return k;
+}
+
+// two keys per vector, same sequence of operations as hash_int64_h1
+inline v128_t hash_int64_h1x2(v128_t keys, v128_t seed) {
+  const v128_t key_size = wasm_i64x2_splat(KEY_SIZE);
+  v128_t k1 = wasm_i64x2_mul(keys, wasm_i64x2_splat(C1));
+  k1 = rotl64x2(k1, 31);
+  k1 = wasm_i64x2_mul(k1, wasm_i64x2_splat(C2));
+  v128_t h1 = wasm_v128_xor(seed, k1);
+  h1 = wasm_v128_xor(h1, key_size);
+  v128_t h2 = wasm_v128_xor(seed, key_size);
+  h1 = wasm_i64x2_add(h1, h2);
+  h2 = wasm_i64x2_add(h2, h1);
+  h1 = fmix64x2(h1);
+  h2 = fmix64x2(h2);
+  return wasm_i64x2_add(h1, h2);
+}
+
+#endif
+
+/**
+ * Computes the first 64-bit half of MurmurHash3_x64_128 for each of the given 8-byte keys.
+ * The result is bit-identical to hashing each key with MurmurHash3_x64_128(&key, 8, seed, ...).
+ * In SIMD builds (-msimd128) four keys are hashed per iteration.
+ */
+inline void hash_int64_h1(const uint64_t* keys, size_t count, uint64_t seed, uint64_t* hashes) {
+  size_t i = 0;
+#ifdef __wasm_simd128__
+  const v128_t seed_x2 = wasm_i64x2_splat(seed);
+  for (; i + 4 <= count; i += 4) {
+    const v128_t keys01 = wasm_v128_load(keys + i);
+    const v128_t keys23 = wasm_v128_load(keys + i + 2);
+    wasm_v128_store(hashes + i, hash_int64_h1x2(keys01, seed_x2));
+    wasm_v128_store(hashes + i + 2, hash_int64_h1x2(keys23, seed_x2));
+  }
+#endif
+  for (; i < count; ++i) hashes[i] = hash_int64_h1(keys[i], seed);
+}
+
+} /* namespace murmur_hash_batch */
+
+#endif
@@ -0,0 +1,129 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#ifndef OP_STATS_HPP_
+#define OP_STATS_HPP_
+
+#include <emscripten/bind.h>
+
+/**
+ * Instrumentation of the hot operations of a module, compiled in with -DENABLE_OP_STATS (make STATS=1).
+ * Every operation (update, merge, serialize, deserialize, query) has the number of calls and
+ * the cumulative time in milliseconds. Counters keep the number of items updated, sketches merged
+ * and bytes deserialized and serialized. Modes of serialized sketches (HLL list/set/HLL, CPC flavors)
+ * are counted by name.
+ * Without ENABLE_OP_STATS the macros expand to nothing, so the bindings do no extra work,
+ * and getStats() returns {enabled: false}.
+ */
+
+#ifdef ENABLE_OP_STATS
+
+#include <map>
+#include <string>
+#include <emscripten/emscripten.h>
+
+class op_stats {
+public:
+  enum op { UPDATE, MERGE, SERIALIZE, DESERIALIZE, QUERY, NUM_OPS };
+  enum counter { ITEMS, MERGED_SKETCHES, DESERIALIZED_BYTES, SERIALIZED_BYTES, NUM_COUNTERS };
+
+  // counts a call and its duration until the end of the scope
+  class timer {
+  public:
+    explicit timer(op o): op_(o), start_(emscripten_get_now()) {}
+    ~timer() {
+      auto& t = instance().ops_[op_];
+      ++t.calls;
+      t.ms += emscripten_get_now() - start_;
+    }
+  private:
+    op op_;
+    double start_;
+  };
+
+  static void count(counter c, double n) { instance().counters_[c] += n; }
+  static void count_mode(const char* name) { ++instance().modes_[name]; }
+
+  static emscripten::val get() {
+    static const char* const OP_NAMES[NUM_OPS] = {"update", "merge", "serialize", "deserialize", "query"};
+    static const char* const COUNTER_NAMES[NUM_COUNTERS] = {"items", "mergedSketches", "deserializedBytes", "serializedBytes"};
+    const auto& s = instance();
+    auto stats = emscripten::val::object();
+    stats.set("enabled", true);
+    for (int i = 0; i < NUM_OPS; ++i) {
+      auto t = emscripten::val::object();
+      t.set("calls", s.ops_[i].calls);
+      t.set("ms", s.ops_[i].ms);
+      stats.set(OP_NAMES[i], t);
+    }
+    for (int i = 0; i < NUM_COUNTERS; ++i) stats.set(COUNTER_NAMES[i], s.counters_[i]);
+    auto modes = emscripten::val::object();
+    for (const auto& it: s.modes_) modes.set(it.first, it.second);
+    stats.set("modes", modes);
+    return stats;
+  }
+
+  static void reset() {
+    auto& s = instance();
+    for (auto& t: s.ops_) t = timing();
+    for (auto& c: s.counters_) c = 0;
+    s.modes_.clear();
+  }
+
+private:
+  struct timing {
+    double calls = 0;
+    double ms = 0;
+  };
+
+  timing ops_[NUM_OPS];
+  double counters_[NUM_COUNTERS] = {};
+  std::map<std::string, double> modes_;
+
+  static op_stats& instance() {
+    static op_stats stats;
+    return stats;
+  }
+};
+
+#define OP_STATS_TIMED(operation) op_stats::timer op_stats_timer_(op_stats::operation)
+#define OP_STATS_COUNT(name, n) op_stats::count(op_stats::name, (n))
+#define OP_STATS_MODE(name) op_stats::count_mode(name)
+
+inline emscripten::val get_op_stats() { return op_stats::get(); }
+inline void reset_op_stats() { op_stats::reset(); }
+
+#else
+
+#define OP_STATS_TIMED(operation) ((void) 0)
+#define OP_STATS_COUNT(name, n) ((void) 0)
+#define OP_STATS_MODE(name) ((void) 0)
+
+inline emscripten::val get_op_stats() {
+  auto stats = emscripten::val::object();
+  stats.set("enabled", false);
+  return stats;
+}
+
+inline void reset_op_stats() {}
+
+#endif
+
+#endif
@@ -0,0 +1,68 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#ifndef QUANTILES_BATCH_HPP_
+#define QUANTILES_BATCH_HPP_
+
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Returns quantiles for several normalized ranks at once.
+ * KLL and REQ sketches build their sorted view on the first quantile query and keep it,
+ * so the view is built once for all ranks, and stays with the sketch if it is
+ * held in a sketch_cache.
+ * @param sketch non-empty quantiles sketch
+ * @param ranks normalized ranks on the interval [0.0, 1.0]
+ * @param inclusive if true, the given ranks are considered inclusive
+ * @return quantiles in the order of the given ranks
+ */
+template<typename Sketch>
+auto get_quantiles_batch(const Sketch& sketch, const std::vector<double>& ranks, bool inclusive) {
+  if (sketch.is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
+  using T = typename std::decay<decltype(sketch.get_quantile(0.0, inclusive))>::type;
+  std::vector<T> quantiles;
+  quantiles.reserve(ranks.size());
+  for (const double rank: ranks) quantiles.push_back(sketch.get_quantile(rank, inclusive));
+  return quantiles;
+}
+
+/**
+ * Returns normalized ranks for several values at once.
+ * Ranks are read through the sketch, so a KLL sketch builds its sorted view on the first value
+ * and keeps it (also across calls if it is held in a sketch_cache), and a REQ sketch computes
+ * each rank from its compactors without building a view.
+ * @param sketch non-empty quantiles sketch
+ * @param values values to be ranked
+ * @param inclusive if true, the weight of a given value is included into its rank
+ * @return ranks on the interval [0.0, 1.0] in the order of the given values
+ */
+template<typename Sketch, typename T>
+std::vector<double> get_ranks_batch(const Sketch& sketch, const std::vector<T>& values, bool inclusive) {
+  if (sketch.is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
+  std::vector<double> ranks;
+  ranks.reserve(values.size());
+  for (const T& value: values) ranks.push_back(sketch.get_rank(value, inclusive));
+  return ranks;
+}
+
+#endif
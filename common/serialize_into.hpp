@@ -0,0 +1,51 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#ifndef SERIALIZE_INTO_HPP_
+#define SERIALIZE_INTO_HPP_
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <strstream>
+
+#include "op_stats.hpp"
+
+/**
+ * Serializes into a caller-owned region, usually a buffer in the WASM heap
+ * that a UDF reuses across calls. This avoids building a temporary vector
+ * and then copying it into a new Uint8Array.
+ * @param ptr start of the region
+ * @param capacity size of the region in bytes
+ * @param serialize callable writing the sketch to the given std::ostream
+ * @return number of bytes written
+ */
+template<typename Serialize>
+size_t serialize_into(intptr_t ptr, size_t capacity, Serialize&& serialize) {
+  OP_STATS_TIMED(SERIALIZE);
+  std::strstream stream(reinterpret_cast<char*>(ptr), capacity);
+  serialize(stream);
+  if (!stream) throw std::length_error("serialized sketch does not fit into " + std::to_string(capacity) + " bytes");
+  const size_t size = static_cast<size_t>(stream.tellp());
+  OP_STATS_COUNT(SERIALIZED_BYTES, size);
+  return size;
+}
+
+#endif
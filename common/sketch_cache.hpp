@@ -0,0 +1,128 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#ifndef SKETCH_CACHE_HPP_
+#define SKETCH_CACHE_HPP_
+
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+/**
+ * Bounded LRU cache of deserialized sketches keyed by their serialized bytes.
+ * Scalar functions often see the same sketch many times in one query
+ * (several getters over one column, or a sketch repeated by a join),
+ * so a hit saves a full deserialization.
+ * Entries are found by a hash of the bytes and confirmed by comparing the bytes themselves,
+ * together with a salt such as the seed the sketch was deserialized with.
+ * Cached sketches are shared and must not be modified by the caller.
+ * Capacity 0 disables caching.
+ */
+template<typename Sketch>
+class sketch_cache {
+public:
+  using sketch_ptr = std::shared_ptr<Sketch>;
+
+  static constexpr size_t DEFAULT_CAPACITY = 16;
+
+  explicit sketch_cache(size_t capacity = DEFAULT_CAPACITY): capacity_(capacity), hits_(0), misses_(0) {}
+
+  /**
+   * Returns the cached sketch for the given bytes and salt,
+   * or deserializes, caches and returns a new one.
+   * @param bytes serialized sketch
+   * @param salt extra part of the key, such as the seed
+   * @param deserialize function that returns a Sketch given the bytes
+   */
+  template<typename Deserialize>
+  sketch_ptr get(const std::string& bytes, uint64_t salt, Deserialize&& deserialize) {
+    const size_t hash = std::hash<std::string>()(bytes);
+    const auto range = index_.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+      auto entry = it->second;
+      if (entry->salt == salt && entry->bytes == bytes) {
+        ++hits_;
+        entries_.splice(entries_.begin(), entries_, entry);
+        return entry->sketch;
+      }
+    }
+    ++misses_;
+    sketch_ptr sketch = std::make_shared<Sketch>(deserialize(bytes));
+    if (capacity_ == 0) return sketch;
+    entries_.push_front(entry{hash, salt, bytes, sketch});
+    index_.emplace(hash, entries_.begin());
+    shrink(capacity_);
+    return sketch;
+  }
+
+  size_t get_capacity() const { return capacity_; }
+
+  void set_capacity(size_t capacity) {
+    capacity_ = capacity;
+    shrink(capacity_);
+  }
+
+  size_t size() const { return entries_.size(); }
+  uint64_t get_hits() const { return hits_; }
+  uint64_t get_misses() const { return misses_; }
+
+  void clear() {
+    entries_.clear();
+    index_.clear();
+    hits_ = 0;
+    misses_ = 0;
+  }
+
+private:
+  struct entry {
+    size_t hash;
+    uint64_t salt;
+    std::string bytes;
+    sketch_ptr sketch;
+  };
+  using entry_list = std::list<entry>;
+
+  size_t capacity_;
+  uint64_t hits_;
+  uint64_t misses_;
+  entry_list entries_; // most recently used first
+  std::unordered_multimap<size_t, typename entry_list::iterator> index_;
+
+  void shrink(size_t capacity) {
+    while (entries_.size() > capacity) {
+      auto last = std::prev(entries_.end());
+      const auto range = index_.equal_range(last->hash);
+      for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == last) {
+          index_.erase(it);
+          break;
+        }
+      }
+      entries_.pop_back();
+    }
+  }
+};
+
+#endif
@@ -0,0 +1,69 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#ifndef THETA_BATCH_UPDATE_HPP_
+#define THETA_BATCH_UPDATE_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <stdexcept>
+
+#include <theta_constants.hpp>
+
+#include "murmur_hash_batch.hpp"
+
+/**
+ * Batched update with 64-bit keys for theta-family update sketches (theta and tuple).
+ * Once the sketch is in estimation mode most keys hash at or above theta and are
+ * rejected by the sketch without changing its state. Such keys are screened out here
+ * using the batch hash kernel (vectorized in SIMD builds), and only the remaining ones
+ * are passed to update_at(i), which is expected to call the regular sketch update for key i.
+ * The resulting sketch is identical to updating with every key.
+ * @param sketch update sketch that must have been built with the given seed
+ * @param keys contiguous array of keys
+ * @param count number of keys
+ * @param seed seed of the sketch
+ * @param update_at function that updates the sketch with the key at the given index
+ */
+template<typename Sketch, typename UpdateAt>
+void update_int64_batch_screened(Sketch& sketch, const uint64_t* keys, size_t count, uint64_t seed, UpdateAt&& update_at) {
+  // same as compute_seed_hash(seed)
+  if (static_cast<uint16_t>(murmur_hash_batch::hash_int64_h1(seed, 0)) != sketch.get_seed_hash()) {
+    throw std::invalid_argument("seed hash mismatch");
+  }
+  const size_t BLOCK_SIZE = 256;
+  uint64_t hashes[BLOCK_SIZE];
+  for (size_t start = 0; start < count; start += BLOCK_SIZE) {
+    const size_t end = std::min(count, start + BLOCK_SIZE);
+    if (sketch.is_empty() || sketch.get_theta64() == datasketches::theta_constants::MAX_THETA) {
+      // every key is retained in exact mode, screening would only add work
+      for (size_t i = start; i < end; ++i) update_at(i);
+      continue;
+    }
+    murmur_hash_batch::hash_int64_h1(keys + start, end - start, seed, hashes);
+    for (size_t i = start; i < end; ++i) {
+      // theta sketches use the first half of the hash shifted to be positive
+      if ((hashes[i - start] >> 1) < sketch.get_theta64()) update_at(i);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,131 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#ifndef CPC_PREAMBLE_ESTIMATE_HPP_
+#define CPC_PREAMBLE_ESTIMATE_HPP_
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include <common_defs.hpp>
+#include <icon_estimator.hpp>
+#include <cpc_confidence.hpp>
+
+/**
+ * Estimate of a serialized CPC sketch computed from the preamble, without decompressing
+ * the surprising value table and the sliding window.
+ * Sketches that were not produced by merging carry the HIP estimate, otherwise the ICON estimate
+ * is a function of lg_k and the number of coupons, which is always in the preamble.
+ * This is the same as cpc_sketch::get_estimate() of the deserialized sketch.
+ * The bounds are computed like cpc_confidence does for the deserialized sketch, with the same
+ * empirical error tables, from the same lg_k, number of coupons and HIP estimate.
+ * is_available() is false if the bytes are not recognized or the seed hash does not match,
+ * in which case deserialization reports the problem.
+ */
+class cpc_preamble_estimate {
+public:
+  cpc_preamble_estimate(const void* bytes, size_t size, uint64_t seed):
+    available_(false), has_hip_(false), lg_k_(0), num_coupons_(0), estimate_(0) {
+    const uint8_t* ptr = static_cast<const uint8_t*>(bytes);
+    if (size < EMPTY_PREAMBLE_BYTES || size < ptr[0] * sizeof(uint32_t)) return;
+    if (ptr[1] != SERIAL_VERSION || ptr[2] != FAMILY) return;
+    const uint8_t lg_k = ptr[3];
+    if (lg_k < MIN_LG_K || lg_k > MAX_LG_K) return;
+    const uint8_t flags = ptr[5];
+    if (!(flags & (1 << IS_COMPRESSED))) return;
+    uint16_t seed_hash;
+    std::memcpy(&seed_hash, ptr + SEED_HASH_OFFSET, sizeof(seed_hash));
+    if (seed_hash != datasketches::compute_seed_hash(seed)) return;
+    has_hip_ = flags & (1 << HAS_HIP);
+    lg_k_ = lg_k;
+    const bool has_table = flags & (1 << HAS_TABLE);
+    const bool has_window = flags & (1 << HAS_WINDOW);
+    available_ = true;
+    if (!has_table && !has_window) return; // empty
+    if (size < NUM_COUPONS_OFFSET + sizeof(uint32_t)) { available_ = false; return; }
+    std::memcpy(&num_coupons_, ptr + NUM_COUPONS_OFFSET, sizeof(num_coupons_));
+    if (has_hip_) {
+      // with both table and window the HIP values follow the number of table entries,
+      // otherwise the number of data words of the one that is present
+      const size_t hip_offset = NUM_COUPONS_OFFSET + 2 * sizeof(uint32_t);
+      if (size < hip_offset + 2 * sizeof(double)) { available_ = false; return; }
+      std::memcpy(&estimate_, ptr + hip_offset + sizeof(double), sizeof(estimate_));
+    } else {
+      estimate_ = datasketches::compute_icon_estimate(lg_k, num_coupons_);
+    }
+  }
+
+  bool is_available() const { return available_; }
+
+  double get_estimate() const { return estimate_; }
+
+  /**
+   * Same as cpc_sketch::get_lower_bound(kappa) of the deserialized sketch.
+   * @param kappa number of standard deviations: 1, 2 or 3 (checked by the caller)
+   */
+  double get_lower_bound(uint8_t kappa) const {
+    if (num_coupons_ == 0) return 0;
+    const double result = estimate_ / (1.0 + kappa * relative_error(kappa, true));
+    return result < num_coupons_ ? num_coupons_ : result;
+  }
+
+  /**
+   * Same as cpc_sketch::get_upper_bound(kappa) of the deserialized sketch.
+   * @param kappa number of standard deviations: 1, 2 or 3 (checked by the caller)
+   */
+  double get_upper_bound(uint8_t kappa) const {
+    if (num_coupons_ == 0) return 0;
+    // rounded up like the library, to be conservative
+    return std::ceil(estimate_ / (1.0 - kappa * relative_error(kappa, false)));
+  }
+
+private:
+  static const uint8_t SERIAL_VERSION = 1;
+  static const uint8_t FAMILY = 16;
+  static const uint8_t MIN_LG_K = 4;
+  static const uint8_t MAX_LG_K = 26;
+  static const size_t EMPTY_PREAMBLE_BYTES = 8;
+  static const size_t SEED_HASH_OFFSET = 6;
+  static const size_t NUM_COUPONS_OFFSET = 8;
+  enum flags { IS_BIG_ENDIAN, IS_COMPRESSED, HAS_HIP, HAS_TABLE, HAS_WINDOW };
+
+  static const uint8_t MAX_LG_K_WITH_DATA = 14;
+
+  // the lower bound uses the measured high side error of the estimate, the upper bound the low side
+  double relative_error(uint8_t kappa, bool high_side) const {
+    double x = has_hip_ ? datasketches::HIP_ERROR_CONSTANT : datasketches::ICON_ERROR_CONSTANT;
+    if (lg_k_ <= MAX_LG_K_WITH_DATA) {
+      const int16_t* data = has_hip_
+        ? (high_side ? datasketches::HIP_HIGH_SIDE_DATA : datasketches::HIP_LOW_SIDE_DATA)
+        : (high_side ? datasketches::ICON_HIGH_SIDE_DATA : datasketches::ICON_LOW_SIDE_DATA);
+      x = data[3 * (lg_k_ - MIN_LG_K) + (kappa - 1)] / 10000.0;
+    }
+    return x / std::sqrt(static_cast<double>(1 << lg_k_));
+  }
+
+  bool available_;
+  bool has_hip_;
+  uint8_t lg_k_;
+  uint32_t num_coupons_;
+  double estimate_;
+};
+
+#endif
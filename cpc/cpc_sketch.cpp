@@ -19,12 +19,63 @@
 
 #include <strstream>
 #include <emscripten/bind.h>
+#include <emscripten/emscripten.h>
 
 #include <cpc_sketch.hpp>
 #include <cpc_union.hpp>
 
+#include "batch_update.hpp"
+#include "cpc_preamble_estimate.hpp"
+#include "handle_table.hpp"
+#include "heap_stats.hpp"
+#include "op_stats.hpp"
+#include "serialize_into.hpp"
+#include "sketch_cache.hpp"
+
+#ifdef USE_ARENA_ALLOCATOR
+using cpc_sketch = datasketches::cpc_sketch_alloc<arena_allocator<uint8_t>>;
+using cpc_union = datasketches::cpc_union_alloc<arena_allocator<uint8_t>>;
+#else
+using datasketches::cpc_sketch;
+using datasketches::cpc_union;
+#endif
+
 const emscripten::val Uint8Array = emscripten::val::global("Uint8Array");
 
+// deserialized sketches for read-only scalar functions, keyed by bytes and seed
+sketch_cache<cpc_sketch> cache;
+
+std::shared_ptr<cpc_sketch> deserialize_cached(const std::string& bytes, uint64_t seed) {
+  return cache.get(bytes, seed, [seed](const std::string& bytes) {
+    return cpc_sketch::deserialize(bytes.data(), bytes.size(), seed);
+  });
+}
+
+// counts the flavor of a serialized sketch in the instrumentation, returns the size
+// the flavor is determined by the number of coupons relative to k
+inline size_t count_flavor(const void* bytes, size_t size) {
+#ifdef ENABLE_OP_STATS
+  const uint8_t* ptr = static_cast<const uint8_t*>(bytes);
+  if (size < 8) return size;
+  // no surprising value table and no window
+  if (!(ptr[5] & (3 << 3))) {
+    OP_STATS_MODE("EMPTY");
+  } else if (size >= 12) {
+    uint32_t num_coupons;
+    std::memcpy(&num_coupons, ptr + 8, sizeof(num_coupons));
+    const uint64_t c = num_coupons;
+    const uint64_t k = static_cast<uint64_t>(1) << ptr[3];
+    if ((c << 5) < 3 * k) OP_STATS_MODE("SPARSE");
+    else if ((c << 1) < k) OP_STATS_MODE("HYBRID");
+    else if ((c << 3) < 27 * k) OP_STATS_MODE("PINNED");
+    else OP_STATS_MODE("SLIDING");
+  }
+#endif
+  return size;
+}
+
+// Building with -DQUERY_ONLY=1 (cpc_sketch_query.js) keeps only the read-only class functions
+// of cpc_sketch used by the scalar UDFs and leaves the rest out of the module.
 EMSCRIPTEN_BINDINGS(cpc_sketch) {
   emscripten::register_vector<double>("VectorDouble");
 
@@ -32,52 +83,207 @@ EMSCRIPTEN_BINDINGS(cpc_sketch) {
     return std::string(reinterpret_cast<std::exception*>(ptr)->what());
   }));
 
+  emscripten::function("getHeapStats", &get_heap_stats);
+  emscripten::function("getStats", &get_op_stats);
+  emscripten::function("resetStats", &reset_op_stats);
+
+  emscripten::function("getCacheStats", emscripten::optional_override([]() {
+    auto stats = emscripten::val::object();
+    stats.set("hits", static_cast<double>(cache.get_hits()));
+    stats.set("misses", static_cast<double>(cache.get_misses()));
+    stats.set("size", cache.size());
+    stats.set("capacity", cache.get_capacity());
+    return stats;
+  }));
+  emscripten::function("setCacheCapacity", emscripten::optional_override([](size_t capacity) {
+    cache.set_capacity(capacity);
+  }));
+  emscripten::function("clearCache", emscripten::optional_override([]() {
+    cache.clear();
+  }));
+
   emscripten::constant("DEFAULT_LG_K", datasketches::cpc_constants::DEFAULT_LG_K);
   emscripten::constant("DEFAULT_SEED", datasketches::DEFAULT_SEED);
 
-  emscripten::class_<datasketches::cpc_sketch>("cpc_sketch")
+  emscripten::class_<cpc_sketch>("cpc_sketch")
+#ifndef QUERY_ONLY
     .constructor(emscripten::optional_override([](uint8_t lg_k, uint64_t seed) {
-      return new datasketches::cpc_sketch(lg_k, seed);
+      return new cpc_sketch(lg_k, seed);
+    }))
+    .function("updateString", emscripten::optional_override([](cpc_sketch& self, const std::string& value) {
+      OP_STATS_TIMED(UPDATE);
+      OP_STATS_COUNT(ITEMS, 1);
+      self.update(value);
+    }))
+    .function("updateInt64", emscripten::optional_override([](cpc_sketch& self, uint64_t value) {
+      OP_STATS_TIMED(UPDATE);
+      OP_STATS_COUNT(ITEMS, 1);
+      self.update(value);
     }))
-    .function("updateString", emscripten::select_overload<void(const std::string&)>(&datasketches::cpc_sketch::update))
-    .function("updateInt64", emscripten::select_overload<void(uint64_t)>(&datasketches::cpc_sketch::update))
-    .function("serializeAsUint8Array", emscripten::optional_override([](const datasketches::cpc_sketch& self) {
+    .function("updateStringBatch", emscripten::optional_override([](cpc_sketch& self, intptr_t offsets, intptr_t bytes, size_t count) {
+      OP_STATS_TIMED(UPDATE);
+      OP_STATS_COUNT(ITEMS, count);
+      update_string_batch(self, packed_items(offsets, bytes, count));
+    }))
+    .function("updateInt64Batch", emscripten::optional_override([](cpc_sketch& self, intptr_t values, size_t count) {
+      OP_STATS_TIMED(UPDATE);
+      OP_STATS_COUNT(ITEMS, count);
+      update_int64_batch(self, reinterpret_cast<const uint64_t*>(values), count);
+    }))
+    .function("serializeAsUint8Array", emscripten::optional_override([](const cpc_sketch& self) {
+      OP_STATS_TIMED(SERIALIZE);
       auto bytes = self.serialize();
+      OP_STATS_COUNT(SERIALIZED_BYTES, bytes.size());
+      count_flavor(bytes.data(), bytes.size());
       return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
     }))
+    .function("serializeInto", emscripten::optional_override([](const cpc_sketch& self, intptr_t bytes, size_t capacity) {
+      return count_flavor(reinterpret_cast<const void*>(bytes), serialize_into(bytes, capacity, [&self](std::ostream& os) { self.serialize(os); }));
+    }))
+    .class_function("getMaxSerializedSizeBytes", &cpc_sketch::get_max_serialized_size_bytes)
+#endif
     .class_function("getEstimate", emscripten::optional_override([](const std::string& sketch_bytes, uint64_t seed) {
-      return datasketches::cpc_sketch::deserialize(sketch_bytes.data(), sketch_bytes.size(), seed).get_estimate();
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, sketch_bytes.size());
+      const cpc_preamble_estimate preamble(sketch_bytes.data(), sketch_bytes.size(), seed);
+      if (preamble.is_available()) return preamble.get_estimate();
+      return deserialize_cached(sketch_bytes, seed)->get_estimate();
     }))
     .class_function("getEstimateAndBounds", emscripten::optional_override([](const std::string& sketch_bytes, uint8_t num_std_devs, uint64_t seed) {
-      const auto sketch = datasketches::cpc_sketch::deserialize(sketch_bytes.data(), sketch_bytes.size(), seed);
-      return std::vector<double>{sketch.get_estimate(), sketch.get_lower_bound(num_std_devs), sketch.get_upper_bound(num_std_devs)};
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, sketch_bytes.size());
+      const cpc_preamble_estimate preamble(sketch_bytes.data(), sketch_bytes.size(), seed);
+      if (preamble.is_available() && num_std_devs >= 1 && num_std_devs <= 3) {
+        return std::vector<double>{preamble.get_estimate(), preamble.get_lower_bound(num_std_devs), preamble.get_upper_bound(num_std_devs)};
+      }
+      const auto sketch = deserialize_cached(sketch_bytes, seed);
+      return std::vector<double>{sketch->get_estimate(), sketch->get_lower_bound(num_std_devs), sketch->get_upper_bound(num_std_devs)};
     }))
     .class_function("toString", emscripten::optional_override([](const std::string& sketch_bytes, uint64_t seed) {
-      return datasketches::cpc_sketch::deserialize(sketch_bytes.data(), sketch_bytes.size(), seed).to_string();
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, sketch_bytes.size());
+      return deserialize_cached(sketch_bytes, seed)->to_string();
     }))
     ;
 
-  emscripten::class_<datasketches::cpc_union>("cpc_union")
+#ifndef QUERY_ONLY
+  emscripten::class_<cpc_union>("cpc_union")
     .constructor(emscripten::optional_override([](uint8_t lg_k, uint64_t seed) {
-      return new datasketches::cpc_union(lg_k, seed);
+      return new cpc_union(lg_k, seed);
     }))
-    .function("updateWithSketch", emscripten::optional_override([](datasketches::cpc_union& self, const datasketches::cpc_sketch& sketch) {
+    .function("updateWithSketch", emscripten::optional_override([](cpc_union& self, const cpc_sketch& sketch) {
+      OP_STATS_TIMED(MERGE);
+      OP_STATS_COUNT(MERGED_SKETCHES, 1);
       self.update(sketch);
     }))
-    .function("updateWithBytes", emscripten::optional_override([](datasketches::cpc_union& self, const std::string& bytes, uint64_t seed) {
-      self.update(datasketches::cpc_sketch::deserialize(bytes.data(), bytes.size(), seed));
+    .function("updateWithBytes", emscripten::optional_override([](cpc_union& self, const std::string& bytes, uint64_t seed) {
+      OP_STATS_TIMED(MERGE);
+      OP_STATS_COUNT(MERGED_SKETCHES, 1);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
+      self.update(cpc_sketch::deserialize(bytes.data(), bytes.size(), seed));
     }))
-    .function("getResultAsUint8Array", emscripten::optional_override([](datasketches::cpc_union& self) {
+    .function("updateWithBuffer", emscripten::optional_override([](cpc_union& self, intptr_t bytes, size_t size, uint64_t seed) {
+      OP_STATS_TIMED(MERGE);
+      OP_STATS_COUNT(MERGED_SKETCHES, 1);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, size);
+      self.update(cpc_sketch::deserialize(reinterpret_cast<const void*>(bytes), size, seed));
+    }))
+    .function("updateWithPacked", emscripten::optional_override([](cpc_union& self, intptr_t offsets, intptr_t bytes, size_t count, uint64_t seed) {
+      OP_STATS_TIMED(MERGE);
+      OP_STATS_COUNT(MERGED_SKETCHES, count);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, packed_items(offsets, bytes, count).total_size());
+      update_union_packed(self, packed_items(offsets, bytes, count), [seed](const char* data, size_t size) {
+        return cpc_sketch::deserialize(data, size, seed);
+      });
+    }))
+    .function("getResultAsUint8Array", emscripten::optional_override([](cpc_union& self) {
+      OP_STATS_TIMED(SERIALIZE);
       auto bytes = self.get_result().serialize();
+      OP_STATS_COUNT(SERIALIZED_BYTES, bytes.size());
+      count_flavor(bytes.data(), bytes.size());
       return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
     }))
+    .function("getResultInto", emscripten::optional_override([](cpc_union& self, intptr_t bytes, size_t capacity) {
+      const auto sketch = self.get_result();
+      return count_flavor(reinterpret_cast<const void*>(bytes), serialize_into(bytes, capacity, [&sketch](std::ostream& os) { sketch.serialize(os); }));
+    }))
     ;
 
   emscripten::function("cpcUnion", emscripten::optional_override([](const std::string& bytes1, const std::string& bytes2, uint8_t lg_k, uint64_t seed) {
-    datasketches::cpc_union u(lg_k, seed);
-    u.update(datasketches::cpc_sketch::deserialize(bytes1.data(), bytes1.size(), seed));
-    u.update(datasketches::cpc_sketch::deserialize(bytes2.data(), bytes2.size(), seed));
+    OP_STATS_TIMED(QUERY);
+    OP_STATS_COUNT(DESERIALIZED_BYTES, bytes1.size() + bytes2.size());
+    cpc_union u(lg_k, seed);
+    u.update(cpc_sketch::deserialize(bytes1.data(), bytes1.size(), seed));
+    u.update(cpc_sketch::deserialize(bytes2.data(), bytes2.size(), seed));
     const auto bytes = u.get_result().serialize();
     return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
   }));
+#endif
+}
+
+// Plain C entry points for the hottest operations, called as Module._cpc_*.
+// Sketches and unions are referred to by handles and bytes are passed as heap pointers,
+// so there is no embind conversion of arguments or results.
+#ifndef QUERY_ONLY
+handle_table<cpc_sketch> sketches;
+handle_table<cpc_union> unions;
+#endif
+
+extern "C" {
+
+#ifndef QUERY_ONLY
+EMSCRIPTEN_KEEPALIVE uint32_t cpc_sketch_create(uint8_t lg_k, uint64_t seed) {
+  return sketches.create(lg_k, seed);
+}
+
+EMSCRIPTEN_KEEPALIVE void cpc_sketch_destroy(uint32_t handle) {
+  sketches.destroy(handle);
+}
+
+EMSCRIPTEN_KEEPALIVE void cpc_sketch_update_int64(uint32_t handle, uint64_t value) {
+  OP_STATS_TIMED(UPDATE);
+  OP_STATS_COUNT(ITEMS, 1);
+  sketches.get(handle).update(value);
+}
+
+EMSCRIPTEN_KEEPALIVE void cpc_sketch_update_string(uint32_t handle, const char* data, size_t size) {
+  OP_STATS_TIMED(UPDATE);
+  OP_STATS_COUNT(ITEMS, 1);
+  sketches.get(handle).update(data, size);
+}
+
+EMSCRIPTEN_KEEPALIVE size_t cpc_sketch_serialize_into(uint32_t handle, intptr_t bytes, size_t capacity) {
+  const auto& sketch = sketches.get(handle);
+  return count_flavor(reinterpret_cast<const void*>(bytes), serialize_into(bytes, capacity, [&sketch](std::ostream& os) { sketch.serialize(os); }));
+}
+
+EMSCRIPTEN_KEEPALIVE uint32_t cpc_union_create(uint8_t lg_k, uint64_t seed) {
+  return unions.create(lg_k, seed);
+}
+
+EMSCRIPTEN_KEEPALIVE void cpc_union_destroy(uint32_t handle) {
+  unions.destroy(handle);
+}
+
+EMSCRIPTEN_KEEPALIVE void cpc_union_update(uint32_t handle, const void* bytes, size_t size, uint64_t seed) {
+  OP_STATS_TIMED(MERGE);
+  OP_STATS_COUNT(MERGED_SKETCHES, 1);
+  OP_STATS_COUNT(DESERIALIZED_BYTES, size);
+  unions.get(handle).update(cpc_sketch::deserialize(bytes, size, seed));
+}
+
+EMSCRIPTEN_KEEPALIVE size_t cpc_union_get_result_into(uint32_t handle, intptr_t bytes, size_t capacity) {
+  const auto sketch = unions.get(handle).get_result();
+  return count_flavor(reinterpret_cast<const void*>(bytes), serialize_into(bytes, capacity, [&sketch](std::ostream& os) { sketch.serialize(os); }));
+}
+#endif
+
+EMSCRIPTEN_KEEPALIVE double cpc_get_estimate(const char* bytes, size_t size, uint64_t seed) {
+  OP_STATS_TIMED(QUERY);
+  OP_STATS_COUNT(DESERIALIZED_BYTES, size);
+  const cpc_preamble_estimate preamble(bytes, size, seed);
+  if (preamble.is_available()) return preamble.get_estimate();
+  return deserialize_cached(std::string(bytes, size), seed)->get_estimate();
+}
+
 }
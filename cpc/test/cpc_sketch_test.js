@@ -46,6 +46,14 @@ generate_udaf_test("cpc_sketch_agg_string", {
   expected_output: cpc_1
 });
 
+// more rows than one batch of updates in the aggregate function, with NULLs and repeats,
+// must build the same sketch as the three distinct values above
+generate_udaf_test("cpc_sketch_agg_string", {
+  input_columns: [`str`],
+  input_rows: `SELECT IF(MOD(i, 7) = 0, NULL, ['a', 'b', 'c'][OFFSET(MOD(i, 3))]) AS str FROM UNNEST(GENERATE_ARRAY(1, 3000)) AS i`,
+  expected_output: cpc_1
+});
+
 const cpc_2 = `FROM_BASE64('CAEQCwAOzJMDAAAAAgAAAAAAAADA/J9AVTYhEhABCEC+rcvjSAAAAA==')`;
 
 generate_udaf_test("cpc_sketch_agg_string", {
@@ -82,6 +90,16 @@ generate_udf_test("cpc_sketch_union", [{
   expected_output: cpc_union_1
 }]);
 
+generate_udf_test("cpc_sketch_union_array", [{
+  inputs: [ `CAST(NULL AS ARRAY<BYTES>)` ],
+  expected_output: null
+}]);
+
+generate_udf_test("cpc_sketch_union_array", [{
+  inputs: [ `[${cpc_1}, ${cpc_2}]` ],
+  expected_output: cpc_union_1
+}]);
+
 generate_udf_test("cpc_sketch_get_estimate", [{
   inputs: [ `CAST(NULL AS BYTES)` ],
   expected_output: null
@@ -112,6 +130,7 @@ generate_udf_test("cpc_sketch_to_string", [{
 '''`
 }]);
 
+// expected from updating with every row, the aggregate function updates in batches
 const cpc_3 = `FROM_BASE64('CgEQCwAezJMAFQAAJgAAAAAAACDomYJAR9CpOgRcw0AMAAAAJgEAALFuuPtTekqPjdsIcV1W8eGS92h1HRSv4ygo4NXXjivr+bTu1EUfnE79HYVQ6agvNz9+Hagp1a4EHx+EY+k2p6o6x2pk0Sliv3NPNigUgRBaQwl3C2j+uFkMGsx4OdrqcdlE53p48+Coa3LN7ZYop6ESxxYUJi83zSxi23wia67Sy/uMTVt3ZCZHMeneexhsvD1oUKDzqjs50zwlZLgrVZhOWEYaR6r92giX4haa9Dw7H3L39AmOVe7RdTL2jD2NDsMWWRKpMT01VCGLWO+NsLO9KudSPM4YwuzWcT8UBng9o84WNabrHqWLWJ/MPLn13rCcdTFTg8V0u3gWDQsbucasWB7U2AWe4CFvqw5ZnlhhMIxuPNOJuW4f6t5ocuJg1jB7LaLfnxelVtFUjKbikMrBq3c8pOHTpGE/OmndNBp9FqHSwVc/q6gjXHU0v/DoQurpoiJjQ61H0ZtUTEqZJDORhIghzFAis2GlfPaAaaHRoo6mTf+shveH9wLBXKuvnJxj364eRQkIWt52KWiTdFPg0Vqsw12dgYbQAEh+LWhua1mXQfrp26qm5M4FbyWSqn0NCNs6vrGxU+Cjx1N4b1itMskgYsbOX0d1mQZZxMKJkulxFYpdNm4x4HLCQDGDqoTtIGP0YA50GRm9ZGoYFU7X2x7v5kzTDRS9MLkinJt4TPYKB4nEi7GcJLlsBG/ImsWEYk914/7gbOSLJ9/uQuLNuc9Yy1wyu2QM8y3JpBQcTtRFbpfMK1mLA8nZaOD4cibYExeNtE09ryk9hFifBWyT26eUizwj8276cEN4HAw3tv26epOdPPXYo5flUui6W1IeO/ErfCEQ2dn2QnOz67WOPqwp78xQ6gpETsTk9AMEMss9Zw8agBnk0gOexr5Nch6b9/S2rt79QIYzrq/KWHZO9McrKCc2U2+MuFda5WJI5CVT6MYUx8csdoLbw4Ma8jSC9SKgrlSOt6INUO28rR9cKgm1B23v+CRm7kT0cUHn1HnY2K5ZuNc5Zwsp2T52fRTdHayhU0qGSpTxeWxKyzRtOAO2PL64uT7Sq6949FDP15Z996snmBgDm/JxVXJ9PgZbmc1pLyVu5V3JYCz6ZDrrmBECYWs/dLLL1bAX9wy5al0zymQNAjFPvkh5UtcPkncGhr10qT7rRidBdDn73d1o7K1dMDBtLilJqq8WUr9XvcKJkG9Xa0aU3HkAUx4uA68d1jgQRyYzeVW3L3vlQSOYBpMNmeKJAT6buzTsCCdWjoaeIV1D1yPmWcST4i4O4HiOyN5RdOgIKaKYDdvalUUrRCVw42T2uVTq03kZDWyp4JqtFSLVFvYqBmFPIdadC1oEFu3e8aCGwkvAooOMwGq4BZyux3U6biAdp8zXooyaCbDhFS4cyQXYhpQmXn6vL00Zdr6Pka4rqYGe9amHOeKaGNU5uIqkcTofSpO0MiEdbUTs51vBMZuKeo6cgbWqUKBcF0mvTZVCdrGW83RZvm5/BQw144KEOhuXDce4W1IE8hM7QbGUzNIOryxSRHYFCQFiWG+HIS+AYjQrc6UzN1GuoDHw0TsHANo11tB70dkzRAsZXTTYwIWGzXp5ueQdoLyIJpgvy46M2/lRbFkCEVmq2cILAAAAAA==')`;
 
 generate_udaf_test("cpc_sketch_agg_int64", {
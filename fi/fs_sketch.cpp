@@ -21,7 +21,16 @@
 
 #include <frequent_items_sketch.hpp>
 
+#include "heap_stats.hpp"
+#include "op_stats.hpp"
+#include "serialize_into.hpp"
+
+#ifdef USE_ARENA_ALLOCATOR
+using frequent_strings_sketch = datasketches::frequent_items_sketch<std::string, uint64_t, std::hash<std::string>,
+  std::equal_to<std::string>, arena_allocator<std::string>>;
+#else
 using frequent_strings_sketch = datasketches::frequent_items_sketch<std::string>;
+#endif
 
 const emscripten::val Uint8Array = emscripten::val::global("Uint8Array");
 
@@ -30,28 +39,51 @@ EMSCRIPTEN_BINDINGS(frequent_strings_sketch) {
     return std::string(reinterpret_cast<std::exception*>(ptr)->what());
   }));
 
+  emscripten::function("getHeapStats", &get_heap_stats);
+  emscripten::function("getStats", &get_op_stats);
+  emscripten::function("resetStats", &reset_op_stats);
+
   emscripten::class_<frequent_strings_sketch>("frequent_strings_sketch")
     .constructor(emscripten::optional_override([](uint8_t lg_max_map_size) {
       return new frequent_strings_sketch(lg_max_map_size);
     }))
     .function("isEmpty", &frequent_strings_sketch::is_empty)
     .function("update", emscripten::optional_override([](frequent_strings_sketch& self, const std::string& str, uint64_t weight) {
+      OP_STATS_TIMED(UPDATE);
+      OP_STATS_COUNT(ITEMS, 1);
       self.update(str, weight);
     }))
     .function("merge", emscripten::optional_override([](frequent_strings_sketch& self, const std::string& bytes) {
+      OP_STATS_TIMED(MERGE);
+      OP_STATS_COUNT(MERGED_SKETCHES, 1);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
       self.merge(frequent_strings_sketch::deserialize(bytes.data(), bytes.size()));
     }))
     .function("serializeAsUint8Array", emscripten::optional_override([](const frequent_strings_sketch& self) {
+      OP_STATS_TIMED(SERIALIZE);
       auto bytes = self.serialize();
+      OP_STATS_COUNT(SERIALIZED_BYTES, bytes.size());
       return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
     }))
+    .function("serializeInto", emscripten::optional_override([](const frequent_strings_sketch& self, intptr_t bytes, size_t capacity) {
+      return serialize_into(bytes, capacity, [&self](std::ostream& os) { self.serialize(os); });
+    }))
+    .function("getSerializedSizeBytes", emscripten::optional_override([](const frequent_strings_sketch& self) {
+      return self.get_serialized_size_bytes();
+    }))
     .class_function("deserialize", emscripten::optional_override([](const std::string& bytes) {
+      OP_STATS_TIMED(DESERIALIZE);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
       return new frequent_strings_sketch(frequent_strings_sketch::deserialize(bytes.data(), bytes.size()));
     }), emscripten::allow_raw_pointers())
     .class_function("toString", emscripten::optional_override([](const std::string& bytes) {
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
       return frequent_strings_sketch::deserialize(bytes.data(), bytes.size()).to_string();
     }))
     .class_function("getResult", emscripten::optional_override([](const std::string& bytes, const std::string& err_type_str, uint64_t threshold) {
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
       datasketches::frequent_items_error_type err_type;
       if (err_type_str == "NO_FALSE_NEGATIVES") {
         err_type = datasketches::NO_FALSE_NEGATIVES;
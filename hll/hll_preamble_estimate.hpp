@@ -0,0 +1,103 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#ifndef HLL_PREAMBLE_ESTIMATE_HPP_
+#define HLL_PREAMBLE_ESTIMATE_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include <hll.hpp>
+#include <HllUtil.hpp>
+
+/**
+ * Estimate and bounds of a serialized HLL sketch computed from the preamble, without deserializing.
+ * Sketches in HLL mode that are not out of order (not produced by a union) carry the HIP accumulator,
+ * which is their estimate, and the current minimum with the number of registers at it, which bound
+ * the number of non-zero registers. Empty sketches are recognized by the flag.
+ * For anything else is_available() is false and the sketch must be deserialized.
+ */
+class hll_preamble_estimate {
+public:
+  hll_preamble_estimate(const void* bytes, size_t size): available_(false), lg_k_(0), estimate_(0), num_non_zeros_(0) {
+    const uint8_t* ptr = static_cast<const uint8_t*>(bytes);
+    if (size < MIN_PREAMBLE_BYTES || ptr[1] != SERIAL_VERSION || ptr[2] != FAMILY) return;
+    lg_k_ = ptr[3];
+    if (lg_k_ < MIN_LG_K || lg_k_ > MAX_LG_K) return;
+    if (ptr[5] & EMPTY_FLAG_MASK) {
+      available_ = true;
+      return;
+    }
+    if (size < REGISTERS_OFFSET || ptr[0] != HLL_PREAMBLE_INTS || (ptr[7] & 3) != MODE_HLL) return;
+    if (ptr[5] & OUT_OF_ORDER_FLAG_MASK) return;
+    std::memcpy(&estimate_, ptr + HIP_ACCUM_OFFSET, sizeof(estimate_));
+    uint32_t num_at_cur_min;
+    std::memcpy(&num_at_cur_min, ptr + NUM_AT_CUR_MIN_OFFSET, sizeof(num_at_cur_min));
+    const uint32_t k = 1 << lg_k_;
+    num_non_zeros_ = ptr[6] == 0 ? k - num_at_cur_min : k;
+    available_ = true;
+  }
+
+  bool is_available() const { return available_; }
+
+  double get_estimate() const { return estimate_; }
+
+  // same as hll_sketch::get_lower_bound() of the deserialized sketch
+  double get_lower_bound(uint8_t num_std_devs) const {
+    return std::max(estimate_ / (1.0 + get_rel_err(false, num_std_devs)), num_non_zeros_);
+  }
+
+  // same as hll_sketch::get_upper_bound() of the deserialized sketch
+  double get_upper_bound(uint8_t num_std_devs) const {
+    return estimate_ / (1.0 + get_rel_err(true, num_std_devs));
+  }
+
+private:
+  static const uint8_t SERIAL_VERSION = 1;
+  static const uint8_t FAMILY = 7;
+  static const uint8_t HLL_PREAMBLE_INTS = 10;
+  static const uint8_t MODE_HLL = 2;
+  static const uint8_t EMPTY_FLAG_MASK = 4;
+  static const uint8_t OUT_OF_ORDER_FLAG_MASK = 16;
+  static const uint8_t MIN_LG_K = 4;
+  static const uint8_t MAX_LG_K = 21;
+  static const size_t MIN_PREAMBLE_BYTES = 8;
+  static const size_t HIP_ACCUM_OFFSET = 8;
+  static const size_t NUM_AT_CUR_MIN_OFFSET = 32;
+  static const size_t REGISTERS_OFFSET = 40;
+
+  bool available_;
+  uint8_t lg_k_;
+  double estimate_;
+  double num_non_zeros_;
+
+  // negative for the upper bound
+  double get_rel_err(bool upper_bound, uint8_t num_std_devs) const {
+    datasketches::HllUtil<>::checkNumStdDev(num_std_devs);
+    if (lg_k_ > 12) {
+      return (upper_bound ? -1.0 : 1.0) * num_std_devs * datasketches::HllUtil<>::HLL_HIP_RSE_FACTOR / std::sqrt(static_cast<double>(1 << lg_k_));
+    }
+    return datasketches::HllUtil<>::getRelErr(upper_bound, false, lg_k_, num_std_devs);
+  }
+};
+
+#endif
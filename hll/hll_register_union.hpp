@@ -0,0 +1,209 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#ifndef HLL_REGISTER_UNION_HPP_
+#define HLL_REGISTER_UNION_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#ifdef __wasm_simd128__
+#include <wasm_simd128.h>
+#endif
+
+#include <hll.hpp>
+
+/**
+ * HLL union with a fast path for serialized inputs in HLL mode with lg_k equal to lg_max_k.
+ * The first such input goes to the underlying hll_union as usual. Registers of the following ones
+ * are merged straight from the serialized bytes (HLL_8 directly, HLL_4 and HLL_6 unpacked on the fly)
+ * into a side array with a per-register max, which is vectorized in SIMD builds.
+ * The side array is passed to the hll_union as one HLL_8 sketch before any other input and
+ * before producing the result. Since register max is commutative, the result is the same as
+ * updating the hll_union with every input in order.
+ * Any other input (LIST or SET mode, different lg_k, unrecognized layout) is deserialized
+ * and goes through the regular path.
+ */
+template<typename Allocator = std::allocator<uint8_t>>
+class hll_register_union_alloc {
+public:
+  using hll_sketch = datasketches::hll_sketch_alloc<Allocator>;
+
+  explicit hll_register_union_alloc(uint8_t lg_max_k, const Allocator& allocator = Allocator()):
+    union_(lg_max_k, allocator), lg_max_k_(lg_max_k), has_hll_input_(false), has_pending_(false),
+    registers_(allocator), image_(allocator) {}
+
+  void update(const hll_sketch& sketch) {
+    flush();
+    union_.update(sketch);
+  }
+
+  void update(const void* bytes, size_t size) {
+    const uint8_t* ptr = static_cast<const uint8_t*>(bytes);
+    if (has_hll_input_ && is_fast_path_eligible(ptr, size)) {
+      if (merge_registers(ptr, size)) return;
+    }
+    const auto sketch = hll_sketch::deserialize(bytes, size);
+    flush();
+    if (is_fast_path_eligible(ptr, size)) has_hll_input_ = true;
+    union_.update(sketch);
+  }
+
+  hll_sketch get_result(datasketches::target_hll_type tgt_type) {
+    flush();
+    return union_.get_result(tgt_type);
+  }
+
+private:
+  static const uint8_t PREAMBLE_INTS = 10;
+  static const uint8_t SERIAL_VERSION = 1;
+  static const uint8_t FAMILY = 7;
+  static const uint8_t MODE_HLL = 2;
+  static const uint8_t COMPACT_FLAG_MASK = 8;
+  static const uint8_t OUT_OF_ORDER_FLAG_MASK = 16;
+  static const uint8_t AUX_TOKEN = 15;
+  static const size_t REGISTERS_OFFSET = 40;
+  static const uint32_t KEY_MASK_26 = (1 << 26) - 1;
+
+  datasketches::hll_union_alloc<Allocator> union_;
+  uint8_t lg_max_k_;
+  bool has_hll_input_;
+  bool has_pending_;
+  std::vector<uint8_t, Allocator> registers_;
+  std::vector<uint8_t, Allocator> image_;
+
+  template<typename T>
+  static T read(const uint8_t* ptr) {
+    T value;
+    std::memcpy(&value, ptr, sizeof(T));
+    return value;
+  }
+
+  template<typename T>
+  static void write(uint8_t* ptr, T value) {
+    std::memcpy(ptr, &value, sizeof(T));
+  }
+
+  bool is_fast_path_eligible(const uint8_t* ptr, size_t size) const {
+    return size >= REGISTERS_OFFSET && ptr[0] == PREAMBLE_INTS && ptr[1] == SERIAL_VERSION && ptr[2] == FAMILY
+      && ptr[3] == lg_max_k_ && (ptr[7] & 3) == MODE_HLL;
+  }
+
+  // returns false if the input is not recognized, in which case nothing is changed
+  bool merge_registers(const uint8_t* ptr, size_t size) {
+    const size_t k = static_cast<size_t>(1) << lg_max_k_;
+    const uint8_t tgt_type = (ptr[7] >> 2) & 3;
+    const uint8_t* src = ptr + REGISTERS_OFFSET;
+    if (tgt_type == datasketches::HLL_8) {
+      if (size < REGISTERS_OFFSET + k) return false;
+      ensure_registers(k);
+      max_merge(registers_.data(), src, k);
+    } else if (tgt_type == datasketches::HLL_6) {
+      if (size < REGISTERS_OFFSET + ((k * 3) >> 2) + 1) return false;
+      ensure_registers(k);
+      for (size_t slot = 0; slot < k; ++slot) {
+        const size_t start_bit = slot * 6;
+        const uint16_t two_bytes = src[start_bit >> 3] | (src[(start_bit >> 3) + 1] << 8);
+        const uint8_t value = (two_bytes >> (start_bit & 7)) & 0x3f;
+        registers_[slot] = std::max(registers_[slot], value);
+      }
+    } else if (tgt_type == datasketches::HLL_4) {
+      const size_t array_bytes = k >> 1;
+      const bool is_compact = ptr[5] & COMPACT_FLAG_MASK;
+      const size_t aux_entries = is_compact ? read<uint32_t>(ptr + 36) : (ptr[4] > 0 ? static_cast<size_t>(1) << ptr[4] : 0);
+      if (size < REGISTERS_OFFSET + array_bytes + aux_entries * sizeof(uint32_t)) return false;
+      ensure_registers(k);
+      const uint8_t cur_min = ptr[6];
+      for (size_t slot = 0; slot < k; ++slot) {
+        const uint8_t nibble = (slot & 1) ? src[slot >> 1] >> 4 : src[slot >> 1] & 0xf;
+        // exceptions are stored in the aux array below
+        if (nibble != AUX_TOKEN) registers_[slot] = std::max(registers_[slot], static_cast<uint8_t>(cur_min + nibble));
+      }
+      const uint8_t* aux = src + array_bytes;
+      for (size_t i = 0; i < aux_entries; ++i) {
+        const uint32_t pair = read<uint32_t>(aux + i * sizeof(uint32_t));
+        if (pair == 0) continue; // empty slot of the hash table in updatable form
+        const size_t slot = pair & KEY_MASK_26 & (k - 1);
+        registers_[slot] = std::max(registers_[slot], static_cast<uint8_t>(pair >> 26));
+      }
+    } else {
+      return false;
+    }
+    has_pending_ = true;
+    return true;
+  }
+
+  void ensure_registers(size_t k) {
+    if (registers_.size() != k) registers_.assign(k, 0);
+  }
+
+  static void max_merge(uint8_t* dst, const uint8_t* src, size_t k) {
+    size_t i = 0;
+#ifdef __wasm_simd128__
+    for (; i + 16 <= k; i += 16) {
+      wasm_v128_store(dst + i, wasm_u8x16_max(wasm_v128_load(dst + i), wasm_v128_load(src + i)));
+    }
+#endif
+    for (; i < k; ++i) dst[i] = std::max(dst[i], src[i]);
+  }
+
+  // passes the side array to the union as a serialized out-of-order HLL_8 sketch
+  void flush() {
+    if (!has_pending_) return;
+    const size_t k = registers_.size();
+    image_.assign(REGISTERS_OFFSET + k, 0);
+    uint8_t cur_min = 64;
+    uint32_t num_at_cur_min = 0;
+    double kxq0 = 0;
+    double kxq1 = 0;
+    for (size_t slot = 0; slot < k; ++slot) {
+      const uint8_t value = registers_[slot];
+      if (value < cur_min) {
+        cur_min = value;
+        num_at_cur_min = 0;
+      }
+      if (value == cur_min) ++num_at_cur_min;
+      if (value < 32) kxq0 += std::ldexp(1.0, -value);
+      else kxq1 += std::ldexp(1.0, -value);
+    }
+    image_[0] = PREAMBLE_INTS;
+    image_[1] = SERIAL_VERSION;
+    image_[2] = FAMILY;
+    image_[3] = lg_max_k_;
+    image_[5] = COMPACT_FLAG_MASK | OUT_OF_ORDER_FLAG_MASK;
+    image_[6] = cur_min;
+    image_[7] = MODE_HLL | (datasketches::HLL_8 << 2);
+    write<double>(image_.data() + 16, kxq0);
+    write<double>(image_.data() + 24, kxq1);
+    write<uint32_t>(image_.data() + 32, num_at_cur_min);
+    std::memcpy(image_.data() + REGISTERS_OFFSET, registers_.data(), k);
+    union_.update(hll_sketch::deserialize(image_.data(), image_.size()));
+    std::fill(registers_.begin(), registers_.end(), 0);
+    has_pending_ = false;
+  }
+};
+
+using hll_register_union = hll_register_union_alloc<>;
+
+#endif
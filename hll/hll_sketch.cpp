@@ -19,9 +19,28 @@
 
 #include <strstream>
 #include <emscripten/bind.h>
+#include <emscripten/emscripten.h>
 
 #include <hll.hpp>
 
+#include "batch_update.hpp"
+#include "handle_table.hpp"
+#include "heap_stats.hpp"
+#include "hll_preamble_estimate.hpp"
+#include "hll_register_union.hpp"
+#include "op_stats.hpp"
+#include "serialize_into.hpp"
+#include "sketch_cache.hpp"
+
+// hll_union is the union with the register fast path
+#ifdef USE_ARENA_ALLOCATOR
+using hll_sketch = datasketches::hll_sketch_alloc<arena_allocator<uint8_t>>;
+using hll_union = hll_register_union_alloc<arena_allocator<uint8_t>>;
+#else
+using datasketches::hll_sketch;
+using hll_union = hll_register_union;
+#endif
+
 datasketches::target_hll_type convert_tgt_type(const std::string& tgt_type_str) {
   if (tgt_type_str == "" || tgt_type_str == "HLL_4") return datasketches::HLL_4;
   if (tgt_type_str == "HLL_6") return datasketches::HLL_6;
@@ -31,6 +50,26 @@ datasketches::target_hll_type convert_tgt_type(const std::string& tgt_type_str)
 
 const emscripten::val Uint8Array = emscripten::val::global("Uint8Array");
 
+// deserialized sketches for read-only scalar functions
+sketch_cache<hll_sketch> cache;
+
+std::shared_ptr<hll_sketch> deserialize_cached(const std::string& bytes) {
+  return cache.get(bytes, 0, [](const std::string& bytes) {
+    return hll_sketch::deserialize(bytes.data(), bytes.size());
+  });
+}
+
+// counts the mode of a serialized sketch (LIST, SET or HLL) in the instrumentation, returns the size
+inline size_t count_mode(const void* bytes, size_t size) {
+#ifdef ENABLE_OP_STATS
+  static const char* const MODES[] = {"LIST", "SET", "HLL", "UNKNOWN"};
+  if (size >= 8) OP_STATS_MODE(MODES[static_cast<const uint8_t*>(bytes)[7] & 3]);
+#endif
+  return size;
+}
+
+// Building with -DQUERY_ONLY=1 (hll_sketch_query.js) keeps only the read-only class functions
+// of hll_sketch used by the scalar UDFs and leaves the rest out of the module.
 EMSCRIPTEN_BINDINGS(hll_sketch) {
   emscripten::register_vector<double>("VectorDouble");
 
@@ -38,51 +77,216 @@ EMSCRIPTEN_BINDINGS(hll_sketch) {
     return std::string(reinterpret_cast<std::exception*>(ptr)->what());
   }));
 
-  emscripten::class_<datasketches::hll_sketch>("hll_sketch")
+  emscripten::function("getHeapStats", &get_heap_stats);
+  emscripten::function("getStats", &get_op_stats);
+  emscripten::function("resetStats", &reset_op_stats);
+
+  emscripten::function("getCacheStats", emscripten::optional_override([]() {
+    auto stats = emscripten::val::object();
+    stats.set("hits", static_cast<double>(cache.get_hits()));
+    stats.set("misses", static_cast<double>(cache.get_misses()));
+    stats.set("size", cache.size());
+    stats.set("capacity", cache.get_capacity());
+    return stats;
+  }));
+  emscripten::function("setCacheCapacity", emscripten::optional_override([](size_t capacity) {
+    cache.set_capacity(capacity);
+  }));
+  emscripten::function("clearCache", emscripten::optional_override([]() {
+    cache.clear();
+  }));
+
+  emscripten::class_<hll_sketch>("hll_sketch")
+#ifndef QUERY_ONLY
     .constructor(emscripten::optional_override([](uint8_t lg_k, const std::string& tgt_type_str) {
-      return new datasketches::hll_sketch(lg_k, convert_tgt_type(tgt_type_str));
+      return new hll_sketch(lg_k, convert_tgt_type(tgt_type_str));
     }))
-    .function("updateString", emscripten::select_overload<void(const std::string&)>(&datasketches::hll_sketch::update))
-    .function("updateInt64", emscripten::select_overload<void(uint64_t)>(&datasketches::hll_sketch::update))
-    .function("serializeAsUint8Array", emscripten::optional_override([](const datasketches::hll_sketch& self) {
+    .function("updateString", emscripten::optional_override([](hll_sketch& self, const std::string& value) {
+      OP_STATS_TIMED(UPDATE);
+      OP_STATS_COUNT(ITEMS, 1);
+      self.update(value);
+    }))
+    .function("updateInt64", emscripten::optional_override([](hll_sketch& self, uint64_t value) {
+      OP_STATS_TIMED(UPDATE);
+      OP_STATS_COUNT(ITEMS, 1);
+      self.update(value);
+    }))
+    .function("updateStringBatch", emscripten::optional_override([](hll_sketch& self, intptr_t offsets, intptr_t bytes, size_t count) {
+      OP_STATS_TIMED(UPDATE);
+      OP_STATS_COUNT(ITEMS, count);
+      update_string_batch(self, packed_items(offsets, bytes, count));
+    }))
+    .function("updateInt64Batch", emscripten::optional_override([](hll_sketch& self, intptr_t values, size_t count) {
+      OP_STATS_TIMED(UPDATE);
+      OP_STATS_COUNT(ITEMS, count);
+      update_int64_batch(self, reinterpret_cast<const uint64_t*>(values), count);
+    }))
+    .function("serializeAsUint8Array", emscripten::optional_override([](const hll_sketch& self) {
+      OP_STATS_TIMED(SERIALIZE);
       auto bytes = self.serialize_compact();
+      OP_STATS_COUNT(SERIALIZED_BYTES, bytes.size());
+      count_mode(bytes.data(), bytes.size());
       return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
     }))
+    .function("serializeInto", emscripten::optional_override([](const hll_sketch& self, intptr_t bytes, size_t capacity) {
+      return count_mode(reinterpret_cast<const void*>(bytes), serialize_into(bytes, capacity, [&self](std::ostream& os) { self.serialize_compact(os); }));
+    }))
+    .class_function("getMaxSerializedSizeBytes", emscripten::optional_override([](uint8_t lg_k, const std::string& tgt_type_str) {
+      return hll_sketch::get_max_updatable_serialization_bytes(lg_k, convert_tgt_type(tgt_type_str));
+    }))
+#endif
     .class_function("getEstimate", emscripten::optional_override([](const std::string& bytes) {
-      return datasketches::hll_sketch::deserialize(bytes.data(), bytes.size()).get_estimate();
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
+      const hll_preamble_estimate preamble(bytes.data(), bytes.size());
+      if (preamble.is_available()) return preamble.get_estimate();
+      return deserialize_cached(bytes)->get_estimate();
     }))
     .class_function("getEstimateAndBounds", emscripten::optional_override([](const std::string& bytes, uint8_t num_std_devs) {
-      const auto sketch = datasketches::hll_sketch::deserialize(bytes.data(), bytes.size());
-      return std::vector<double>{sketch.get_estimate(), sketch.get_lower_bound(num_std_devs), sketch.get_upper_bound(num_std_devs)};
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
+      const hll_preamble_estimate preamble(bytes.data(), bytes.size());
+      if (preamble.is_available()) {
+        return std::vector<double>{preamble.get_estimate(), preamble.get_lower_bound(num_std_devs), preamble.get_upper_bound(num_std_devs)};
+      }
+      const auto sketch = deserialize_cached(bytes);
+      return std::vector<double>{sketch->get_estimate(), sketch->get_lower_bound(num_std_devs), sketch->get_upper_bound(num_std_devs)};
     }))
     .class_function("toString", emscripten::optional_override([](const std::string& bytes) {
-      return datasketches::hll_sketch::deserialize(bytes.data(), bytes.size()).to_string();
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
+      return deserialize_cached(bytes)->to_string();
     }))
     ;
 
-  emscripten::class_<datasketches::hll_union>("hll_union")
+#ifndef QUERY_ONLY
+  // exposed as hll_union: same interface with a fast path for serialized inputs in HLL mode
+  emscripten::class_<hll_union>("hll_union")
     .constructor(emscripten::optional_override([](uint8_t lg_k) {
-      return new datasketches::hll_union(lg_k);
+      return new hll_union(lg_k);
     }))
-    .function("updateWithSketch", emscripten::optional_override([](datasketches::hll_union& self, const datasketches::hll_sketch& sketch) {
+    .function("updateWithSketch", emscripten::optional_override([](hll_union& self, const hll_sketch& sketch) {
+      OP_STATS_TIMED(MERGE);
+      OP_STATS_COUNT(MERGED_SKETCHES, 1);
       self.update(sketch);
     }))
-    .function("updateWithBytes", emscripten::optional_override([](datasketches::hll_union& self, const std::string& bytes) {
-      self.update(datasketches::hll_sketch::deserialize(bytes.data(), bytes.size()));
+    .function("updateWithBytes", emscripten::optional_override([](hll_union& self, const std::string& bytes) {
+      OP_STATS_TIMED(MERGE);
+      OP_STATS_COUNT(MERGED_SKETCHES, 1);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
+      self.update(bytes.data(), bytes.size());
     }))
-    .function("getResultAsUint8Array", emscripten::optional_override([](datasketches::hll_union& self, const std::string& tgt_type_str) {
+    .function("updateWithBuffer", emscripten::optional_override([](hll_union& self, intptr_t bytes, size_t size) {
+      OP_STATS_TIMED(MERGE);
+      OP_STATS_COUNT(MERGED_SKETCHES, 1);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, size);
+      self.update(reinterpret_cast<const void*>(bytes), size);
+    }))
+    .function("updateWithPacked", emscripten::optional_override([](hll_union& self, intptr_t offsets, intptr_t bytes, size_t count) {
+      OP_STATS_TIMED(MERGE);
+      OP_STATS_COUNT(MERGED_SKETCHES, count);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, packed_items(offsets, bytes, count).total_size());
+      const packed_items items(offsets, bytes, count);
+      for (size_t i = 0; i < items.size(); ++i) {
+        if (items.item_size(i) > 0) self.update(items.item_data(i), items.item_size(i));
+      }
+    }))
+    .function("getResultAsUint8Array", emscripten::optional_override([](hll_union& self, const std::string& tgt_type_str) {
+      OP_STATS_TIMED(SERIALIZE);
       auto bytes = self.get_result(convert_tgt_type(tgt_type_str)).serialize_compact();
+      OP_STATS_COUNT(SERIALIZED_BYTES, bytes.size());
+      count_mode(bytes.data(), bytes.size());
       return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
     }))
+    .function("getResultInto", emscripten::optional_override([](hll_union& self, intptr_t bytes, size_t capacity, const std::string& tgt_type_str) {
+      const auto sketch = self.get_result(convert_tgt_type(tgt_type_str));
+      return count_mode(reinterpret_cast<const void*>(bytes), serialize_into(bytes, capacity, [&sketch](std::ostream& os) { sketch.serialize_compact(os); }));
+    }))
     ;
 
   emscripten::function("hllUnion", emscripten::optional_override([](
     const std::string& bytes1, const std::string& bytes2, uint8_t lg_k, const std::string& tgt_type_str
   ) {
-    datasketches::hll_union u(lg_k);
-    u.update(datasketches::hll_sketch::deserialize(bytes1.data(), bytes1.size()));
-    u.update(datasketches::hll_sketch::deserialize(bytes2.data(), bytes2.size()));
+    hll_union u(lg_k);
+    u.update(hll_sketch::deserialize(bytes1.data(), bytes1.size()));
+    u.update(hll_sketch::deserialize(bytes2.data(), bytes2.size()));
     const auto bytes = u.get_result(convert_tgt_type(tgt_type_str)).serialize_compact();
     return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
   }));
+#endif
+}
+
+// Plain C entry points for the hottest operations, called as Module._hll_*.
+// Sketches and unions are referred to by handles and bytes are passed as heap pointers,
+// so there is no embind conversion of arguments or results.
+// Target types are passed as 4, 6 or 8.
+#ifndef QUERY_ONLY
+handle_table<hll_sketch> sketches;
+handle_table<hll_union> unions;
+
+static datasketches::target_hll_type convert_tgt_type(uint8_t bits) {
+  if (bits == 4) return datasketches::HLL_4;
+  if (bits == 6) return datasketches::HLL_6;
+  if (bits == 8) return datasketches::HLL_8;
+  throw std::invalid_argument("unrecognized HLL target type HLL_" + std::to_string(bits));
+}
+#endif
+
+extern "C" {
+
+#ifndef QUERY_ONLY
+EMSCRIPTEN_KEEPALIVE uint32_t hll_sketch_create(uint8_t lg_k, uint8_t tgt_type_bits) {
+  return sketches.create(lg_k, convert_tgt_type(tgt_type_bits));
+}
+
+EMSCRIPTEN_KEEPALIVE void hll_sketch_destroy(uint32_t handle) {
+  sketches.destroy(handle);
+}
+
+EMSCRIPTEN_KEEPALIVE void hll_sketch_update_int64(uint32_t handle, uint64_t value) {
+  OP_STATS_TIMED(UPDATE);
+  OP_STATS_COUNT(ITEMS, 1);
+  sketches.get(handle).update(value);
+}
+
+EMSCRIPTEN_KEEPALIVE void hll_sketch_update_string(uint32_t handle, const char* data, size_t size) {
+  OP_STATS_TIMED(UPDATE);
+  OP_STATS_COUNT(ITEMS, 1);
+  sketches.get(handle).update(data, size);
+}
+
+EMSCRIPTEN_KEEPALIVE size_t hll_sketch_serialize_into(uint32_t handle, intptr_t bytes, size_t capacity) {
+  const auto& sketch = sketches.get(handle);
+  return count_mode(reinterpret_cast<const void*>(bytes), serialize_into(bytes, capacity, [&sketch](std::ostream& os) { sketch.serialize_compact(os); }));
+}
+
+EMSCRIPTEN_KEEPALIVE uint32_t hll_union_create(uint8_t lg_k) {
+  return unions.create(lg_k);
+}
+
+EMSCRIPTEN_KEEPALIVE void hll_union_destroy(uint32_t handle) {
+  unions.destroy(handle);
+}
+
+EMSCRIPTEN_KEEPALIVE void hll_union_update(uint32_t handle, const void* bytes, size_t size) {
+  OP_STATS_TIMED(MERGE);
+  OP_STATS_COUNT(MERGED_SKETCHES, 1);
+  OP_STATS_COUNT(DESERIALIZED_BYTES, size);
+  unions.get(handle).update(bytes, size);
+}
+
+EMSCRIPTEN_KEEPALIVE size_t hll_union_get_result_into(uint32_t handle, intptr_t bytes, size_t capacity, uint8_t tgt_type_bits) {
+  const auto sketch = unions.get(handle).get_result(convert_tgt_type(tgt_type_bits));
+  return count_mode(reinterpret_cast<const void*>(bytes), serialize_into(bytes, capacity, [&sketch](std::ostream& os) { sketch.serialize_compact(os); }));
+}
+#endif
+
+EMSCRIPTEN_KEEPALIVE double hll_get_estimate(const char* bytes, size_t size) {
+  OP_STATS_TIMED(QUERY);
+  OP_STATS_COUNT(DESERIALIZED_BYTES, size);
+  const hll_preamble_estimate preamble(bytes, size);
+  if (preamble.is_available()) return preamble.get_estimate();
+  return deserialize_cached(std::string(bytes, size))->get_estimate();
+}
+
 }
@@ -46,6 +46,14 @@ generate_udaf_test("hll_sketch_agg_string", {
   expected_output: hll_1
 });
 
+// more rows than one batch of updates in the aggregate function, with NULLs and repeats,
+// must build the same sketch as the three distinct values above
+generate_udaf_test("hll_sketch_agg_string", {
+  input_columns: [`str`],
+  input_rows: `SELECT IF(MOD(i, 7) = 0, NULL, ['a', 'b', 'c'][OFFSET(MOD(i, 3))]) AS str FROM UNNEST(GENERATE_ARRAY(1, 3000)) AS i`,
+  expected_output: hll_1
+});
+
 const hll_2 = `FROM_BASE64('AgEHDAMIAwBvGdwGwL9qEp160As=')`;
 
 generate_udaf_test("hll_sketch_agg_string", {
@@ -76,6 +84,16 @@ generate_udf_test("hll_sketch_union", [{
   expected_output: hll_union_1
 }]);
 
+generate_udf_test("hll_sketch_union_array", [{
+  inputs: [ `CAST(NULL AS ARRAY<BYTES>)` ],
+  expected_output: null
+}]);
+
+generate_udf_test("hll_sketch_union_array", [{
+  inputs: [ `[${hll_1}, ${hll_2}]` ],
+  expected_output: hll_union_1
+}]);
+
 generate_udf_test("hll_sketch_get_estimate", [{
   inputs: [ `CAST(NULL AS BYTES)` ],
   expected_output: null
@@ -106,6 +124,7 @@ generate_udf_test("hll_sketch_to_string", [{
 '''`
 }]);
 
+// expected from updating with every row, the aggregate function updates in batches
 const hll_3 = `FROM_BASE64('CgEHDAAIAAI/Uk0InnjDQAAAAPBfcpJAAAAAAAAAAAByAQAAAAAAAFQjESCDUyBCAzNRElExO2MhQjAyIiQyNRUyMxFRIEJDQjY4JDIkIghjIFIjIxIUQCEjMBFGIyIhUTQhJBIkEyQlA0MkIxNTEkQDQSIDFyEDEyElI1MTFjJiVTEmISAxESYTNCkRYUMXESQwY0ACQUMHFTchEzEgEzZDQlE0QkMCUxNkMkMyAiETMhMiJkIUEVJTERQzcCEmkTN0ZiAWQWMxAiEzMRIEMkBKEzUzEyISIUQTIhNQMwJyESQCQDYBMiIQIgYSJBZAQlRiIgcTEWQxQjAhdhFEMhAhFjYkITQUQyJDM1UAAhNBMiEhUhIEERRBVDMhZEMTQiFDBhQ1UkMhNRAiNDQTI1IDM0NEMEI1EAETAxEggkYjATMFMTAgMiJUEiEVIRYTMxQzNBEjEQMkJAFAETEkEkElYiQhIBUUFVNjJTM1IhIyFRETYkJBJkEiIjU0IyQVITciQ1VUNDMCEkMyEyIjUyQyQBMgIjR2IzETIDBFMgJBMzISFxEVJSISNUIyABFVAyMgQWQSeFMwAEE0AiERQ0MmEiERIiQjIAQiIyYhFSJxEkIxFEMyIxMiASASISVCJRAjJhNzMTQjMBMkISAhEkMjM3IRIzITEiAyJRMFYTIyUTRhE0EXcUczciAhNTESEBBCIjMxQhFSFgV0IhYTRTUxUkNgRSQRQyETJVM0IxJCKBJCQhYBMjMjSRAhElQTJ1QxA4RHNSNCYxMUdDYkKBJCEAIVESURMxRhQAQTIkEWISNAAiITQDACEhMSESFCNBFRQmETEDZxMzBDExIBQhMiEAISJUIGIBUhAyVRMhIjIzAyZ2QjcCJyYRNjQlJAAlVCFiJFIgJTVTAjNGMwYzQSREIQKAIxcRU0E0IWIkNyZRUCKCAxBEQURBEhRUIUUSIRcnJwZWMVVHNyQhAmASFBEkI3IlQSIhcRRoBBQkUSITAjJhIWIyMhERUFQkJFE0BUJRUSBiVCMjIWoDMjUiaDBAQUEWIBMyEkZFNSISAxIiRSMiQjMgUyABEgIiMzFxSVMgEVMVIkMQIRIjRhMREwNUIBRgEiMRETNDSBJEJSEycUIjUCMwEzMzAyMiZCCAJCITZENCMjImMwE0sRIyEBE0IhIhNCE0AVAoIxIgETUlEjIzEFYSBCQAJSMCNSQhIkVVUiEUQhIBISIhEUQSJWQDQSIDJjMzEkEiUjBABUYBMTIkExAyZZITFEgRQQMmEUIyJiQwEyYiIlACI6ISEBSBQiUiEyEzUSNCViQiIhEhMUNSIyEiIVMjJREzJBRUIhQScAEhETQjMiACElIyE1M0IyYUAyQjIRFGVAAzQSMRMTAiNUQhMgIRIRYSIQGiNhEUExEDABFTODMnJ1JCIWETkkAyJVIiM3MSQhERKUEkGFRjJAIGIgIDIyIVIVExciNFJCIihCIUEDM1MDIxFCNCYjIjETI0ISFAIhQSIBMEAiNQFBNBQhCHJxEyKiU2MlNTNWN0JDQWJBQiIREBBBVyEyRTURVjASEwMhE0MhVRIARzMCMhiCM1IjMzEhMUNJYiIUAmIjQCAyIyQyMBdINCAiMFRSQjQBMDUicxIhIjRBQUE1MkFSUAAXUxNRFFIyEnEhREAiB1ITVGI1RAJCNoExEBIjQyRDQTo0QkMABSUzQlVxIjMQAQIzIhNkEEEAIAA4FjNXUxIyQiVDNkUjMAJRMlFCIRM0IRJBUQNiQykyIhJTIhUyRCFDIkETAkIjUgF0MCMiKTIhI1VBECERMyIxMRAjETJCBAEiIhMxMVQTMTAVUgBCMxEqVBJBYlJTISQEYEEkEhRDFzIkYjMjERElQgEQEiACJCQCMWMiBZESQhQzBlMEMhMEE0RSQ0EhETIyFQBDMRGEAhMCIhMxASIxAgMBRCEyEQETRBQgE0JRIScjMSMRIkIhMjEDICJEBSImEiUJMDMxJQEiYnQjAUMUEhIEIxExQhMHQwZVFCJgEmQjMxMlERkSEyQSBCMVUxYyYSMDEEJiISEBMwGVQnYiIDMjMSECEylTASMREzIyMjMTEjgRHFMoI2MyUkIiN3IkRGFKFSLTMjBCdDIlUxI2dRMxE1EDICE0FiYiNAJHMhBWVUMldBJRJTAyImQhMyIEAyETMSElIhIBEQIkAiIQM3IDYzMDURIyUmUSQjJBkwMBFMZ1FTACFUI0ElQxNBAxFiAjMmSSFERCICEyA3ETEyIVOGI0JCJVMWZhgiJDNBBlVCESElE2EzQzIFcxIiFREiZBMhFUFxU1FEOCIiJSABRSITcSIyIzYxIjFQEmNSVDWBoxERMxIhwgQREgFIIgIiIjMhI0NCFAQUAFUwMSQBIDETFhMjATFFUTFCAzMzNFJxISBAMBEiFTIxIjRiUkJDUAIzM1FWESElIlIUOCJhBEQgIlEiUlEhEREyIAEzVTETAUAUMSMhOBCUMRMkITMiRClEIiIWEwIjFSUhJjJCIRQRDhIkMUAXsFBEUgBQQRYjZGImVRUhBAQmFBQyMkA1ABEIExQQISISQRUgBQNDRBIiAiRARRMRAhIlUZMCEgMiQBNUEwJiISQxQyIiFQQjIROEMAICAkITRjMRQTJRAxMlETMTIhEzQzZTFRMxMxIWEkQkMnMVIFM2EhI7I1IiRDQiNjIjMkMQEoMzEzJhIyBQARMhJFEhEgJTIUISNhMkQjEQNDECJCQiIjIiISIzdEFDJUESQVAhMiRDIVEjUy')`;
 
 generate_udaf_test("hll_sketch_agg_int64", {
@@ -0,0 +1,81 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#ifndef KLL_MERGE_SERIALIZED_HPP_
+#define KLL_MERGE_SERIALIZED_HPP_
+
+#include <cstdint>
+#include <cstring>
+
+#include <kll_sketch.hpp>
+
+/**
+ * Merges a serialized KLL sketch of floats into the given sketch.
+ * A serialized sketch not in estimation mode (all items in level zero, each with weight one)
+ * is merged by updating the target with its items straight from the bytes, which is exactly
+ * what kll_sketch::merge does for such a sketch, so no temporary sketch is deserialized.
+ * Empty and single item sketches are handled the same way.
+ * Sketches in estimation mode are deserialized and merged as usual, since their higher levels
+ * go through the internal compaction of the target.
+ */
+template<typename Sketch>
+void kll_merge_serialized(Sketch& sketch, const void* bytes, size_t size) {
+  static const uint8_t FAMILY = 15;
+  static const uint8_t SERIAL_VERSION_FULL = 1;
+  static const uint8_t SERIAL_VERSION_SINGLE = 2;
+  static const uint8_t PREAMBLE_INTS_SHORT = 2;
+  static const uint8_t PREAMBLE_INTS_FULL = 5;
+  static const uint8_t EMPTY_FLAG_MASK = 1;
+  static const uint8_t SINGLE_ITEM_FLAG_MASK = 4;
+  static const size_t N_OFFSET = 8;
+  static const size_t NUM_LEVELS_OFFSET = 18;
+  // one level offset, min and max item
+  static const size_t LEVEL_ZERO_ITEMS_OFFSET = 20 + sizeof(uint32_t) + 2 * sizeof(float);
+
+  const uint8_t* ptr = static_cast<const uint8_t*>(bytes);
+  if (size >= N_OFFSET && ptr[2] == FAMILY && ptr[6] == datasketches::kll_constants::DEFAULT_M) {
+    const uint8_t flags = ptr[3];
+    if (ptr[0] == PREAMBLE_INTS_SHORT && ptr[1] == SERIAL_VERSION_FULL && (flags & EMPTY_FLAG_MASK)) return;
+    if (ptr[0] == PREAMBLE_INTS_SHORT && ptr[1] == SERIAL_VERSION_SINGLE && (flags & SINGLE_ITEM_FLAG_MASK)
+      && size == N_OFFSET + sizeof(float)) {
+      float item;
+      std::memcpy(&item, ptr + N_OFFSET, sizeof(item));
+      sketch.update(item);
+      return;
+    }
+    if (ptr[0] == PREAMBLE_INTS_FULL && ptr[1] == SERIAL_VERSION_FULL && !(flags & (EMPTY_FLAG_MASK | SINGLE_ITEM_FLAG_MASK))
+      && size >= LEVEL_ZERO_ITEMS_OFFSET && ptr[NUM_LEVELS_OFFSET] == 1) {
+      uint64_t n;
+      std::memcpy(&n, ptr + N_OFFSET, sizeof(n));
+      if (size == LEVEL_ZERO_ITEMS_OFFSET + n * sizeof(float)) {
+        const uint8_t* items = ptr + LEVEL_ZERO_ITEMS_OFFSET;
+        for (uint64_t i = 0; i < n; ++i) {
+          float item;
+          std::memcpy(&item, items + i * sizeof(float), sizeof(item));
+          sketch.update(item);
+        }
+        return;
+      }
+    }
+  }
+  sketch.merge(Sketch::deserialize(bytes, size));
+}
+
+#endif
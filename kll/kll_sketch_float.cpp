@@ -17,21 +17,66 @@
  * under the License.
  */
 
+#include <limits>
 #include <emscripten/bind.h>
+#include <emscripten/emscripten.h>
 
 #include <kll_sketch.hpp>
 #include <kolmogorov_smirnov.hpp>
 
+#include "handle_table.hpp"
+#include "heap_stats.hpp"
+#include "kll_merge_serialized.hpp"
+#include "op_stats.hpp"
+#include "quantiles_batch.hpp"
+#include "serialize_into.hpp"
+#include "sketch_cache.hpp"
+
+#ifdef USE_ARENA_ALLOCATOR
+using kll_sketch_float = datasketches::kll_sketch<float, std::less<float>, arena_allocator<float>>;
+#else
 using kll_sketch_float = datasketches::kll_sketch<float>;
+#endif
 
 const emscripten::val Uint8Array = emscripten::val::global("Uint8Array");
+const emscripten::val Float32Array = emscripten::val::global("Float32Array");
+const emscripten::val Float64Array = emscripten::val::global("Float64Array");
+
+// deserialized sketches for read-only scalar functions, never handed out to JavaScript
+sketch_cache<kll_sketch_float> cache;
+
+std::shared_ptr<const kll_sketch_float> deserialize_cached(const std::string& bytes) {
+  return cache.get(bytes, 0, [](const std::string& bytes) {
+    return kll_sketch_float::deserialize(bytes.data(), bytes.size());
+  });
+}
 
 EMSCRIPTEN_BINDINGS(kll_sketch_float) {
   emscripten::function("getExceptionMessage", emscripten::optional_override([](intptr_t ptr) {
     return std::string(reinterpret_cast<std::exception*>(ptr)->what());
   }));
 
+  emscripten::function("getHeapStats", &get_heap_stats);
+  emscripten::function("getStats", &get_op_stats);
+  emscripten::function("resetStats", &reset_op_stats);
+
+  emscripten::function("getCacheStats", emscripten::optional_override([]() {
+    auto stats = emscripten::val::object();
+    stats.set("hits", static_cast<double>(cache.get_hits()));
+    stats.set("misses", static_cast<double>(cache.get_misses()));
+    stats.set("size", cache.size());
+    stats.set("capacity", cache.get_capacity());
+    return stats;
+  }));
+  emscripten::function("setCacheCapacity", emscripten::optional_override([](size_t capacity) {
+    cache.set_capacity(capacity);
+  }));
+  emscripten::function("clearCache", emscripten::optional_override([]() {
+    cache.clear();
+  }));
+
   emscripten::register_vector<float>("VectorFloat");
+  emscripten::register_vector<double>("VectorDouble");
 
   emscripten::constant("DEFAULT_K", datasketches::kll_constants::DEFAULT_K);
 
@@ -41,33 +86,145 @@ EMSCRIPTEN_BINDINGS(kll_sketch_float) {
     }))
     .function("isEmpty", &kll_sketch_float::is_empty)
     .function("update", emscripten::optional_override([](kll_sketch_float& self, float value) {
+      OP_STATS_TIMED(UPDATE);
+      OP_STATS_COUNT(ITEMS, 1);
       self.update(value);
     }))
     .function("merge", emscripten::optional_override([](kll_sketch_float& self, const std::string& bytes) {
-      self.merge(kll_sketch_float::deserialize(bytes.data(), bytes.size()));
+      OP_STATS_TIMED(MERGE);
+      OP_STATS_COUNT(MERGED_SKETCHES, 1);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
+      kll_merge_serialized(self, bytes.data(), bytes.size());
+    }))
+    .function("mergeBuffer", emscripten::optional_override([](kll_sketch_float& self, intptr_t bytes, size_t size) {
+      OP_STATS_TIMED(MERGE);
+      OP_STATS_COUNT(MERGED_SKETCHES, 1);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, size);
+      kll_merge_serialized(self, reinterpret_cast<const void*>(bytes), size);
     }))
     .function("serializeAsUint8Array", emscripten::optional_override([](const kll_sketch_float& self) {
+      OP_STATS_TIMED(SERIALIZE);
       auto bytes = self.serialize();
+      OP_STATS_COUNT(SERIALIZED_BYTES, bytes.size());
       return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
     }))
+    .function("serializeInto", emscripten::optional_override([](const kll_sketch_float& self, intptr_t bytes, size_t capacity) {
+      return serialize_into(bytes, capacity, [&self](std::ostream& os) { self.serialize(os); });
+    }))
+    .function("getSerializedSizeBytes", emscripten::optional_override([](const kll_sketch_float& self) {
+      return self.get_serialized_size_bytes();
+    }))
     .class_function("deserialize", emscripten::optional_override([](const std::string& bytes) {
+      OP_STATS_TIMED(DESERIALIZE);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
       return new kll_sketch_float(kll_sketch_float::deserialize(bytes.data(), bytes.size()));
     }), emscripten::allow_raw_pointers())
+    // read-only queries of serialized sketches through the cache, which keeps the deserialized sketches internal;
+    // the functions that return NULL in SQL for an empty sketch return null
+    .class_function("getNFromBytes", emscripten::optional_override([](const std::string& bytes) {
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
+      return deserialize_cached(bytes)->get_n();
+    }))
+    .class_function("getNumRetainedFromBytes", emscripten::optional_override([](const std::string& bytes) {
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
+      return deserialize_cached(bytes)->get_num_retained();
+    }))
+    .class_function("getMinValueFromBytes", emscripten::optional_override([](const std::string& bytes) {
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
+      return deserialize_cached(bytes)->get_min_item();
+    }))
+    .class_function("getMaxValueFromBytes", emscripten::optional_override([](const std::string& bytes) {
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
+      return deserialize_cached(bytes)->get_max_item();
+    }))
+    .class_function("getRankFromBytes", emscripten::optional_override([](const std::string& bytes, float value, bool inclusive) {
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
+      const auto sketch = deserialize_cached(bytes);
+      if (sketch->is_empty()) return emscripten::val::null();
+      return emscripten::val(sketch->get_rank(value, inclusive));
+    }))
+    .class_function("getQuantileFromBytes", emscripten::optional_override([](const std::string& bytes, double rank, bool inclusive) {
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
+      const auto sketch = deserialize_cached(bytes);
+      if (sketch->is_empty()) return emscripten::val::null();
+      return emscripten::val(sketch->get_quantile(rank, inclusive));
+    }))
+    .class_function("getQuantilesFromBytes", emscripten::optional_override([](const std::string& bytes, const std::vector<double>& ranks, bool inclusive) {
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
+      const auto sketch = deserialize_cached(bytes);
+      if (sketch->is_empty()) return emscripten::val::null();
+      const auto quantiles = get_quantiles_batch(*sketch, ranks, inclusive);
+      return Float32Array.new_(emscripten::typed_memory_view(quantiles.size(), quantiles.data()));
+    }))
+    .class_function("getRanksFromBytes", emscripten::optional_override([](const std::string& bytes, const std::vector<float>& values, bool inclusive) {
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
+      const auto sketch = deserialize_cached(bytes);
+      if (sketch->is_empty()) return emscripten::val::null();
+      const auto ranks = get_ranks_batch(*sketch, values, inclusive);
+      return Float64Array.new_(emscripten::typed_memory_view(ranks.size(), ranks.data()));
+    }))
+    .class_function("getPMFFromBytes", emscripten::optional_override([](const std::string& bytes, const std::vector<float>& split_points, bool inclusive) {
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
+      const auto sketch = deserialize_cached(bytes);
+      if (sketch->is_empty()) return emscripten::val::null();
+      const auto pmf = sketch->get_PMF(split_points.data(), split_points.size(), inclusive);
+      return emscripten::val::array(pmf.begin(), pmf.end());
+    }))
+    .class_function("getCDFFromBytes", emscripten::optional_override([](const std::string& bytes, const std::vector<float>& split_points, bool inclusive) {
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
+      const auto sketch = deserialize_cached(bytes);
+      if (sketch->is_empty()) return emscripten::val::null();
+      const auto cdf = sketch->get_CDF(split_points.data(), split_points.size(), inclusive);
+      return emscripten::val::array(cdf.begin(), cdf.end());
+    }))
+    .class_function("toStringFromBytes", emscripten::optional_override([](const std::string& bytes) {
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
+      return deserialize_cached(bytes)->to_string();
+    }))
+    .class_function("getNormalizedRankErrorFromBytes", emscripten::optional_override([](const std::string& bytes, bool pmf) {
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
+      return deserialize_cached(bytes)->get_normalized_rank_error(pmf);
+    }))
     .function("getN", &kll_sketch_float::get_n)
     .function("getNumRetained", &kll_sketch_float::get_num_retained)
     .function("getMinValue", &kll_sketch_float::get_min_item)
     .function("getMaxValue", &kll_sketch_float::get_max_item)
     .function("getRank", &kll_sketch_float::get_rank)
     .function("getQuantile", &kll_sketch_float::get_quantile)
+    .function("getQuantiles", emscripten::optional_override([](const kll_sketch_float& self, const std::vector<double>& ranks, bool inclusive) {
+      OP_STATS_TIMED(QUERY);
+      const auto quantiles = get_quantiles_batch(self, ranks, inclusive);
+      return Float32Array.new_(emscripten::typed_memory_view(quantiles.size(), quantiles.data()));
+    }))
+    .function("getRanks", emscripten::optional_override([](const kll_sketch_float& self, const std::vector<float>& values, bool inclusive) {
+      OP_STATS_TIMED(QUERY);
+      const auto ranks = get_ranks_batch(self, values, inclusive);
+      return Float64Array.new_(emscripten::typed_memory_view(ranks.size(), ranks.data()));
+    }))
     .function("getPMF", emscripten::optional_override([](const kll_sketch_float& self, const std::vector<float>& split_points, bool inclusive) {
+      OP_STATS_TIMED(QUERY);
       const auto pmf = self.get_PMF(split_points.data(), split_points.size(), inclusive);
       return emscripten::val::array(pmf.begin(), pmf.end());
     }))
     .function("getCDF", emscripten::optional_override([](const kll_sketch_float& self, const std::vector<float>& split_points, bool inclusive) {
+      OP_STATS_TIMED(QUERY);
       const auto cdf = self.get_CDF(split_points.data(), split_points.size(), inclusive);
       return emscripten::val::array(cdf.begin(), cdf.end());
     }))
     .function("toString", emscripten::optional_override([](const kll_sketch_float& self) {
+      OP_STATS_TIMED(QUERY);
       return self.to_string();
     }))
     .function("getNormalizedRankError", emscripten::optional_override([](const kll_sketch_float& self, bool pmf) {
@@ -76,6 +233,8 @@ EMSCRIPTEN_BINDINGS(kll_sketch_float) {
     ;
 
   emscripten::function("kolmogorovSmirnovTest", emscripten::optional_override([](const std::string& sketch_bytes1, const std::string& sketch_bytes2, double pvalue) {
+    OP_STATS_TIMED(QUERY);
+    OP_STATS_COUNT(DESERIALIZED_BYTES, sketch_bytes1.size() + sketch_bytes2.size());
     return datasketches::kolmogorov_smirnov::test(
       kll_sketch_float::deserialize(sketch_bytes1.data(), sketch_bytes1.size()),
       kll_sketch_float::deserialize(sketch_bytes2.data(), sketch_bytes2.size()),
@@ -83,3 +242,51 @@ EMSCRIPTEN_BINDINGS(kll_sketch_float) {
     );
   }));
 }
+
+// Plain C entry points for the hottest operations, called as Module._kll_*.
+// Sketches are referred to by handles and bytes are passed as heap pointers,
+// so there is no embind conversion of arguments or results.
+handle_table<kll_sketch_float> sketches;
+
+extern "C" {
+
+EMSCRIPTEN_KEEPALIVE uint32_t kll_sketch_float_create(uint16_t k) {
+  return sketches.create(k);
+}
+
+EMSCRIPTEN_KEEPALIVE void kll_sketch_float_destroy(uint32_t handle) {
+  sketches.destroy(handle);
+}
+
+EMSCRIPTEN_KEEPALIVE void kll_sketch_float_update(uint32_t handle, float value) {
+  OP_STATS_TIMED(UPDATE);
+  OP_STATS_COUNT(ITEMS, 1);
+  sketches.get(handle).update(value);
+}
+
+EMSCRIPTEN_KEEPALIVE void kll_sketch_float_merge(uint32_t handle, const void* bytes, size_t size) {
+  OP_STATS_TIMED(MERGE);
+  OP_STATS_COUNT(MERGED_SKETCHES, 1);
+  OP_STATS_COUNT(DESERIALIZED_BYTES, size);
+  kll_merge_serialized(sketches.get(handle), bytes, size);
+}
+
+EMSCRIPTEN_KEEPALIVE size_t kll_sketch_float_serialize_into(uint32_t handle, intptr_t bytes, size_t capacity) {
+  const auto& sketch = sketches.get(handle);
+  return serialize_into(bytes, capacity, [&sketch](std::ostream& os) { sketch.serialize(os); });
+}
+
+EMSCRIPTEN_KEEPALIVE size_t kll_sketch_float_get_serialized_size_bytes(uint32_t handle) {
+  return sketches.get(handle).get_serialized_size_bytes();
+}
+
+EMSCRIPTEN_KEEPALIVE float kll_sketch_float_get_quantile(const char* bytes, size_t size, double rank, bool inclusive) {
+  OP_STATS_TIMED(QUERY);
+  OP_STATS_COUNT(DESERIALIZED_BYTES, size);
+  const auto sketch = deserialize_cached(std::string(bytes, size));
+  // NaN for an empty sketch, where the SQL function returns NULL
+  if (sketch->is_empty()) return std::numeric_limits<float>::quiet_NaN();
+  return sketch->get_quantile(rank, inclusive);
+}
+
+}
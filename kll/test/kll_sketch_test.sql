@@ -41,6 +41,12 @@ select `$BQ_DATASET`.kll_sketch_float_get_rank(`$BQ_DATASET`.kll_sketch_float_me
 # expected 10
 select `$BQ_DATASET`.kll_sketch_float_get_quantile(`$BQ_DATASET`.kll_sketch_float_merge(sketch), 0.5, true) from kll_sketch;
 
+# expected 1, 10, 20
+select `$BQ_DATASET`.kll_sketch_float_get_quantiles(`$BQ_DATASET`.kll_sketch_float_merge(sketch), [0.0, 0.5, 1.0], true) from kll_sketch;
+
+# expected 0.25, 0.5, 1
+select `$BQ_DATASET`.kll_sketch_float_get_ranks(`$BQ_DATASET`.kll_sketch_float_merge(sketch), [5.0, 10.0, 20.0], true) from kll_sketch;
+
 # expected 20
 select `$BQ_DATASET`.kll_sketch_float_get_n(`$BQ_DATASET`.kll_sketch_float_merge(sketch)) from kll_sketch;
 
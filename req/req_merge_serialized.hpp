@@ -0,0 +1,84 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#ifndef REQ_MERGE_SERIALIZED_HPP_
+#define REQ_MERGE_SERIALIZED_HPP_
+
+#include <cstdint>
+#include <cstring>
+
+#include <req_sketch.hpp>
+
+/**
+ * Merges a serialized REQ sketch of floats into the given sketch.
+ * A serialized sketch not in estimation mode (raw items, or one compactor with weight one)
+ * is merged by updating the target with its items straight from the bytes,
+ * so no temporary sketch is deserialized. The result is the same as if the target
+ * had seen those items in the stream. Empty sketches are skipped.
+ * Sketches in estimation mode, with a different accuracy mode or in an unrecognized layout
+ * are deserialized and merged as usual.
+ */
+template<typename Sketch>
+void req_merge_serialized(Sketch& sketch, const void* bytes, size_t size) {
+  static const uint8_t FAMILY = 17;
+  static const uint8_t SERIAL_VERSION = 1;
+  static const uint8_t PREAMBLE_INTS_EXACT = 2;
+  static const uint8_t EMPTY_FLAG_MASK = 1 << 2;
+  static const uint8_t HRA_FLAG_MASK = 1 << 3;
+  static const uint8_t RAW_ITEMS_FLAG_MASK = 1 << 4;
+  static const size_t ITEMS_OFFSET = 8;
+  // compactor: state, section size, lg weight, number of sections, padding, number of items
+  static const size_t LG_WEIGHT_OFFSET = ITEMS_OFFSET + sizeof(uint64_t) + sizeof(float);
+  static const size_t NUM_ITEMS_OFFSET = LG_WEIGHT_OFFSET + 4;
+  static const size_t COMPACTOR_ITEMS_OFFSET = NUM_ITEMS_OFFSET + sizeof(uint32_t);
+
+  const uint8_t* ptr = static_cast<const uint8_t*>(bytes);
+  const auto update_items = [&sketch](const uint8_t* items, size_t num_items) {
+    for (size_t i = 0; i < num_items; ++i) {
+      float item;
+      std::memcpy(&item, items + i * sizeof(float), sizeof(item));
+      sketch.update(item);
+    }
+  };
+  if (size >= ITEMS_OFFSET && ptr[0] == PREAMBLE_INTS_EXACT && ptr[1] == SERIAL_VERSION && ptr[2] == FAMILY) {
+    const uint8_t flags = ptr[3];
+    if (flags & EMPTY_FLAG_MASK) return;
+    const uint8_t num_compactors = ptr[6];
+    const uint8_t num_raw_items = ptr[7];
+    if (static_cast<bool>(flags & HRA_FLAG_MASK) == sketch.is_HRA() && num_compactors == 1) {
+      if (flags & RAW_ITEMS_FLAG_MASK) {
+        if (size == ITEMS_OFFSET + num_raw_items * sizeof(float)) {
+          update_items(ptr + ITEMS_OFFSET, num_raw_items);
+          return;
+        }
+      } else if (size >= COMPACTOR_ITEMS_OFFSET && ptr[LG_WEIGHT_OFFSET] == 0) {
+        uint32_t num_items;
+        std::memcpy(&num_items, ptr + NUM_ITEMS_OFFSET, sizeof(num_items));
+        if (size == COMPACTOR_ITEMS_OFFSET + static_cast<size_t>(num_items) * sizeof(float)) {
+          update_items(ptr + COMPACTOR_ITEMS_OFFSET, num_items);
+          return;
+        }
+      }
+    }
+  }
+  sketch.merge(Sketch::deserialize(bytes, size));
+}
+
+#endif
@@ -97,6 +97,26 @@ generate_udf_test("req_sketch_float_get_quantile", [{
   expected_output: 10
 }]);
 
+generate_udf_test("req_sketch_float_get_quantiles", [{
+  inputs: [ `CAST(NULL AS BYTES)`, `[0.5]`, true ],
+  expected_output: `[]`
+}]);
+
+generate_udf_test("req_sketch_float_get_quantiles", [{
+  inputs: [ req_3, `[0.0, 0.5, 1.0]`, true ],
+  expected_output: `[1.0, 10.0, 20.0]`
+}]);
+
+generate_udf_test("req_sketch_float_get_ranks", [{
+  inputs: [ `CAST(NULL AS BYTES)`, `[10.0]`, true ],
+  expected_output: `[]`
+}]);
+
+generate_udf_test("req_sketch_float_get_ranks", [{
+  inputs: [ req_3, `[5.0, 10.0, 20.0]`, true ],
+  expected_output: `[0.25, 0.5, 1.0]`
+}]);
+
 generate_udf_test("req_sketch_float_get_min_value", [{
   inputs: [ `CAST(NULL AS BYTES)` ],
   expected_output: null
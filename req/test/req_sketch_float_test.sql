@@ -35,6 +35,12 @@ select `$BQ_DATASET`.req_sketch_float_get_rank(`$BQ_DATASET`.req_sketch_float_me
 # expected 10
 select `$BQ_DATASET`.req_sketch_float_get_quantile(`$BQ_DATASET`.req_sketch_float_merge(sketch), 0.5, true) from req_sketch;
 
+# expected 1, 10, 20
+select `$BQ_DATASET`.req_sketch_float_get_quantiles(`$BQ_DATASET`.req_sketch_float_merge(sketch), [0.0, 0.5, 1.0], true) from req_sketch;
+
+# expected 0.25, 0.5, 1
+select `$BQ_DATASET`.req_sketch_float_get_ranks(`$BQ_DATASET`.req_sketch_float_merge(sketch), [5.0, 10.0, 20.0], true) from req_sketch;
+
 # expected 0.5, 0.5
 select `$BQ_DATASET`.req_sketch_float_get_pmf(`$BQ_DATASET`.req_sketch_float_merge(sketch), [10.0], true) from req_sketch;
 
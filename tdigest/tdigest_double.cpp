@@ -21,15 +21,30 @@
 
 #include <tdigest.hpp>
 
+#include "heap_stats.hpp"
+#include "op_stats.hpp"
+#include "serialize_into.hpp"
+
+#ifdef USE_ARENA_ALLOCATOR
+using tdigest_double = datasketches::tdigest<double, arena_allocator<double>>;
+#else
 using tdigest_double = datasketches::tdigest_double;
+#endif
 
 const emscripten::val Uint8Array = emscripten::val::global("Uint8Array");
+const emscripten::val Float64Array = emscripten::val::global("Float64Array");
 
 EMSCRIPTEN_BINDINGS(tdigest_double) {
   emscripten::function("getExceptionMessage", emscripten::optional_override([](intptr_t ptr) {
     return std::string(reinterpret_cast<std::exception*>(ptr)->what());
   }));
 
+  emscripten::function("getHeapStats", &get_heap_stats);
+  emscripten::function("getStats", &get_op_stats);
+  emscripten::function("resetStats", &reset_op_stats);
+
+  emscripten::register_vector<double>("VectorDouble");
+
   emscripten::constant("DEFAULT_K", tdigest_double::DEFAULT_K);
 
   emscripten::class_<tdigest_double>("tdigest_double")
@@ -37,16 +52,40 @@ EMSCRIPTEN_BINDINGS(tdigest_double) {
       return new tdigest_double(k);
     }))
     .function("isEmpty", &tdigest_double::is_empty)
-    .function("update", &tdigest_double::update)
+    .function("update", emscripten::optional_override([](tdigest_double& self, double value) {
+      OP_STATS_TIMED(UPDATE);
+      OP_STATS_COUNT(ITEMS, 1);
+      self.update(value);
+    }))
     .function("merge", emscripten::optional_override([](tdigest_double& self, const std::string& bytes) {
+      OP_STATS_TIMED(MERGE);
+      OP_STATS_COUNT(MERGED_SKETCHES, 1);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
       auto td = tdigest_double::deserialize(bytes.data(), bytes.size());
       self.merge(td);
     }))
+    .function("mergeBuffer", emscripten::optional_override([](tdigest_double& self, intptr_t bytes, size_t size) {
+      OP_STATS_TIMED(MERGE);
+      OP_STATS_COUNT(MERGED_SKETCHES, 1);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, size);
+      auto td = tdigest_double::deserialize(reinterpret_cast<const void*>(bytes), size);
+      self.merge(td);
+    }))
     .function("serializeAsUint8Array", emscripten::optional_override([](const tdigest_double& self) {
+      OP_STATS_TIMED(SERIALIZE);
       const auto bytes = self.serialize();
+      OP_STATS_COUNT(SERIALIZED_BYTES, bytes.size());
       return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
     }))
+    .function("serializeInto", emscripten::optional_override([](const tdigest_double& self, intptr_t bytes, size_t capacity) {
+      return serialize_into(bytes, capacity, [&self](std::ostream& os) { self.serialize(os); });
+    }))
+    .function("getSerializedSizeBytes", emscripten::optional_override([](const tdigest_double& self) {
+      return self.get_serialized_size_bytes();
+    }))
     .class_function("deserialize", emscripten::optional_override([](const std::string& bytes) {
+      OP_STATS_TIMED(DESERIALIZE);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
       return new tdigest_double(tdigest_double::deserialize(bytes.data(), bytes.size()));
     }), emscripten::allow_raw_pointers())
     .function("getTotalWeight", &tdigest_double::get_total_weight)
@@ -54,7 +93,37 @@ EMSCRIPTEN_BINDINGS(tdigest_double) {
     .function("getMaxValue", &tdigest_double::get_max_value)
     .function("getRank", &tdigest_double::get_rank)
     .function("getQuantile", &tdigest_double::get_quantile)
+    // buffered values are merged once up front so that each query below reads the same centroids
+    .function("getQuantiles", emscripten::optional_override([](tdigest_double& self, const std::vector<double>& ranks) {
+      OP_STATS_TIMED(QUERY);
+      self.compress();
+      std::vector<double> quantiles;
+      quantiles.reserve(ranks.size());
+      for (const double rank: ranks) quantiles.push_back(self.get_quantile(rank));
+      return Float64Array.new_(emscripten::typed_memory_view(quantiles.size(), quantiles.data()));
+    }))
+    .function("getRanks", emscripten::optional_override([](tdigest_double& self, const std::vector<double>& values) {
+      OP_STATS_TIMED(QUERY);
+      self.compress();
+      std::vector<double> ranks;
+      ranks.reserve(values.size());
+      for (const double value: values) ranks.push_back(self.get_rank(value));
+      return Float64Array.new_(emscripten::typed_memory_view(ranks.size(), ranks.data()));
+    }))
+    .function("getPMF", emscripten::optional_override([](tdigest_double& self, const std::vector<double>& split_points) {
+      OP_STATS_TIMED(QUERY);
+      self.compress();
+      const auto pmf = self.get_PMF(split_points.data(), split_points.size());
+      return Float64Array.new_(emscripten::typed_memory_view(pmf.size(), pmf.data()));
+    }))
+    .function("getCDF", emscripten::optional_override([](tdigest_double& self, const std::vector<double>& split_points) {
+      OP_STATS_TIMED(QUERY);
+      self.compress();
+      const auto cdf = self.get_CDF(split_points.data(), split_points.size());
+      return Float64Array.new_(emscripten::typed_memory_view(cdf.size(), cdf.data()));
+    }))
     .function("toString", emscripten::optional_override([](const tdigest_double& self) {
+      OP_STATS_TIMED(QUERY);
       return self.to_string();
     }))
     ;
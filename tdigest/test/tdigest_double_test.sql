@@ -41,6 +41,18 @@ select `$BQ_DATASET`.tdigest_double_get_rank(`$BQ_DATASET`.tdigest_double_merge(
 # expected 10
 select `$BQ_DATASET`.tdigest_double_get_quantile(`$BQ_DATASET`.tdigest_double_merge(sketch), 0.5) from tdigest_double;
 
+# expected 0.5
+select `$BQ_DATASET`.tdigest_double_get_ranks(`$BQ_DATASET`.tdigest_double_merge(sketch), [10.0]) from tdigest_double;
+
+# expected 10
+select `$BQ_DATASET`.tdigest_double_get_quantiles(`$BQ_DATASET`.tdigest_double_merge(sketch), [0.5]) from tdigest_double;
+
+# expected 0.5, 0.5
+select `$BQ_DATASET`.tdigest_double_get_pmf(`$BQ_DATASET`.tdigest_double_merge(sketch), [10.0]) from tdigest_double;
+
+# expected 0.5, 1
+select `$BQ_DATASET`.tdigest_double_get_cdf(`$BQ_DATASET`.tdigest_double_merge(sketch), [10.0]) from tdigest_double;
+
 # expected 20
 select `$BQ_DATASET`.tdigest_double_get_total_weight(`$BQ_DATASET`.tdigest_double_merge(sketch)) from tdigest_double;
 
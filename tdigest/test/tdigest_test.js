@@ -96,6 +96,46 @@ generate_udf_test("tdigest_double_get_quantile", [{
   expected_output: 11
 }]);
 
+generate_udf_test("tdigest_double_get_ranks", [{
+  inputs: [ `CAST(NULL AS BYTES)`, `[10.0]` ],
+  expected_output: `[]`
+}]);
+
+generate_udf_test("tdigest_double_get_ranks", [{
+  inputs: [ td_3, `[10.0]` ],
+  expected_output: `[0.475]`
+}]);
+
+generate_udf_test("tdigest_double_get_quantiles", [{
+  inputs: [ `CAST(NULL AS BYTES)`, `[0.5]` ],
+  expected_output: `[]`
+}]);
+
+generate_udf_test("tdigest_double_get_quantiles", [{
+  inputs: [ td_3, `[0.5]` ],
+  expected_output: `[11.0]`
+}]);
+
+generate_udf_test("tdigest_double_get_pmf", [{
+  inputs: [ `CAST(NULL AS BYTES)`, `[10.0]` ],
+  expected_output: `[]`
+}]);
+
+generate_udf_test("tdigest_double_get_pmf", [{
+  inputs: [ td_3, `[10.0]` ],
+  expected_output: `[0.475, 0.525]`
+}]);
+
+generate_udf_test("tdigest_double_get_cdf", [{
+  inputs: [ `CAST(NULL AS BYTES)`, `[10.0]` ],
+  expected_output: `[]`
+}]);
+
+generate_udf_test("tdigest_double_get_cdf", [{
+  inputs: [ td_3, `[10.0]` ],
+  expected_output: `[0.475, 1.0]`
+}]);
+
 generate_udf_test("tdigest_double_get_min_value", [{
   inputs: [ `CAST(NULL AS BYTES)` ],
   expected_output: null
@@ -0,0 +1,64 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef BATCH_UPDATE_THETA_SKETCH_HPP_
+#define BATCH_UPDATE_THETA_SKETCH_HPP_
+
+#include <theta_sketch.hpp>
+
+#include "batch_update.hpp"
+#include "theta_batch_update.hpp"
+
+/**
+ * Update theta sketch with batched updates.
+ * The library sketch only keeps the seed hash, but screening keys by their hash needs the seed,
+ * so it is kept here from construction and batches cannot be hashed with a different seed.
+ */
+template<typename Allocator = std::allocator<uint64_t>>
+class batch_update_theta_sketch_alloc: public datasketches::update_theta_sketch_alloc<Allocator> {
+public:
+  using base = datasketches::update_theta_sketch_alloc<Allocator>;
+
+  batch_update_theta_sketch_alloc(uint8_t lg_k, uint64_t seed, float p, const Allocator& allocator = Allocator()):
+    base(typename base::builder(allocator).set_lg_k(lg_k).set_seed(seed).set_p(p).build()),
+    seed_(seed) {}
+
+  /**
+   * Updates the sketch with a contiguous array of 64-bit keys.
+   * The result is identical to calling update(keys[i]) for every i.
+   */
+  void update_batch(const uint64_t* keys, size_t count) {
+    update_int64_batch_screened(*this, keys, count, seed_, [this, keys](size_t i) { this->update(keys[i]); });
+  }
+
+  /**
+   * Updates the sketch with packed string keys.
+   * Empty keys are skipped to match update(const std::string&).
+   */
+  void update_batch(const packed_items& keys) {
+    update_string_batch(*this, keys);
+  }
+
+private:
+  uint64_t seed_;
+};
+
+using batch_update_theta_sketch = batch_update_theta_sketch_alloc<>;
+
+#endif
@@ -46,6 +46,14 @@ generate_udaf_test("theta_sketch_agg_string", {
   expected_output: theta_1
 });
 
+// more rows than one batch of updates in the aggregate function, with NULLs and repeats,
+// must build the same sketch as the three distinct values above
+generate_udaf_test("theta_sketch_agg_string", {
+  input_columns: [`str`],
+  input_rows: `SELECT IF(MOD(i, 7) = 0, NULL, ['a', 'b', 'c'][OFFSET(MOD(i, 3))]) AS str FROM UNNEST(GENERATE_ARRAY(1, 3000)) AS i`,
+  expected_output: theta_1
+});
+
 const theta_2 = `FROM_BASE64('AQQDPwEazJMDEIFfUcrcGW6aAe192ejCXiH3k2yKaRSQ')`;
 
 generate_udaf_test("theta_sketch_agg_string", {
@@ -76,6 +84,16 @@ generate_udf_test("theta_sketch_union", [{
   expected_output: theta_union_1
 }]);
 
+generate_udf_test("theta_sketch_union_array", [{
+  inputs: [ `CAST(NULL AS ARRAY<BYTES>)` ],
+  expected_output: null
+}]);
+
+generate_udf_test("theta_sketch_union_array", [{
+  inputs: [ `[${theta_1}, ${theta_2}]` ],
+  expected_output: theta_union_1
+}]);
+
 generate_udf_test("theta_sketch_get_estimate", [{
   inputs: [ `CAST(NULL AS BYTES)` ],
   expected_output: null
@@ -162,6 +180,31 @@ generate_udf_test("theta_sketch_get_estimate", [{
   expected_output: 2
 }]);
 
+generate_udf_test("theta_sketch_set_expression", [{
+  inputs: [ `CAST(NULL AS STRING)`, `[${theta_1}, ${theta_2}]` ],
+  expected_output: null
+}]);
+
+generate_udf_test("theta_sketch_set_expression", [{
+  inputs: [ `'UNION(0, 1)'`, `[${theta_1}, ${theta_2}]` ],
+  expected_output: theta_union_1
+}]);
+
+generate_udf_test("theta_sketch_set_expression", [{
+  inputs: [ `'INTERSECTION(0, 1)'`, `[${theta_1}, ${theta_2}]` ],
+  expected_output: theta_intersection
+}]);
+
+generate_udf_test("theta_sketch_set_expression", [{
+  inputs: [ `'A_NOT_B(UNION(0, 1), 1)'`, `[${theta_1}, ${theta_2}]` ],
+  expected_output: theta_a_not_b
+}]);
+
+generate_udf_test("theta_sketch_set_expression_estimate_and_bounds", [{
+  inputs: [ `'INTERSECTION(UNION(0, 1), 1)'`, `[${theta_1}, ${theta_2}]`, 1 ],
+  expected_output: `STRUCT(3 AS estimate, 3 AS lower_bound, 3 AS upper_bound)`
+}]);
+
 generate_udf_test("theta_sketch_jaccard_similarity", [{
   inputs: [ `CAST(NULL AS BYTES)`, `CAST(NULL AS BYTES)` ],
   expected_output: null
@@ -182,6 +225,21 @@ generate_udf_test("theta_sketch_jaccard_similarity", [{
   expected_output: `STRUCT(0.2 AS lower_bound, 0.2 AS estimate, 0.2 AS upper_bound)`
 }]);
 
+generate_udf_test("theta_sketch_jaccard_matrix", [{
+  inputs: [ `CAST(NULL AS ARRAY<BYTES>)` ],
+  expected_output: null
+}]);
+
+generate_udf_test("theta_sketch_jaccard_matrix", [{
+  inputs: [ `[${theta_1}, ${theta_2}, ${theta_1}]` ],
+  expected_output: `[
+    STRUCT(0 AS index_a, 1 AS index_b, 0.2 AS lower_bound, 0.2 AS estimate, 0.2 AS upper_bound),
+    STRUCT(0 AS index_a, 2 AS index_b, 1.0 AS lower_bound, 1.0 AS estimate, 1.0 AS upper_bound),
+    STRUCT(1 AS index_a, 2 AS index_b, 0.2 AS lower_bound, 0.2 AS estimate, 0.2 AS upper_bound)
+  ]`
+}]);
+
+// expected from updating with every row, the aggregate function updates in batches
 const theta_3 = `FROM_BASE64('AgQDNgIazJOI2wmVmcIORMwUHLq5RvX6vANDDcOYafHagm31FRxAyQgbfyZfHK6cXlu9nAyuSw3Y5yDG20eD0yTFxfYYqhtUAC6763N9mDFgY3kkzVBludYyfoSC8b+Wj3BFBSTittWUzAJlaZk1z9A7O+JY8s1Ct8UDqPUJAh6RWugNTAX1DMmVdSJ38xPtnltAG5MaqHqvBaI/40laLBeMENPyA/ClmV7GWILEhfPewrIrAAKvVcTZHAxuSIdkIwBJeACf0+gBqQ8kXsEJBJl95rkPPD0hGu9h5BK8Tq9KH7uBvpCjP+RaAq9wfeQhIEFGxK3+hsBkJB4VimzBG2THfCmRBV+wxMh8WBaKnif6K4BGEOTuXWjBjsRGcyBeAB7R4hPRWBsxbe1HWqCS1YCqqVcDHmwRyBQcDbXJW1Q6kEzf04zk/NALWss0RHxADMsBFg/MASepKdWMUALH4FyO6gDcyihi0esAoxKk94yOH8HYoc6VXA4SNV0hFtLqtzKTXlpGjmYlyZXXAilDEivNxALfA//dLWCm6OYm568AVYL0MAeGBS4DaqaUlOa1IG+U+1DejOxygasNLNnwjS2WF5Toe38jpERIEN3+fRF5npD0R2FIVZdMBjFeAAaPsM+x3BMDkMaOhIAkkh7YaI8BVXm5eG6jBuRzXaqJHCta8ASmglB65hQo3BhEsQ1dxZ8uClKMIaR7zAxtERwn71ACchikHGPBIZH6aYRjBe275wgurAJcCmxfuVDsSw00OH6JNU64G8L0ETxar4xfyAxl58sIaGFIyfuMKPjAyaXPiwrUCCCQIeAiuE62QDxB5BBfKvL05ONCNlwQfiVZAKl8A3/OHAeEYW0BSlA7bYegngEIkZ6yAYpXDrRlCRa3HE5T9iQPLtF2x6SIeYSAVKawjUFXC0WfKSSvxH8aYV4f/qFk3rBut7BBWuzGqyT3BCvQcdIUgA2pGgGXHyBAkIYq9B0DRpckuai8Bdk+0p3O3Fp7VoAEJxDczKoaaQEGIlOTARykCZcgWhN1lCyaElMxGMBUS3O47MYDwt//W9t3CpCWKm7YcDgPZkvzp3HDNcjDvZRD8hIg7zrPB0Llf/bcrCW1las73rCJJx3tWJ8En2331WTIByi58B+ofCcZdBmHS2BZb92sG2AAAshInfavAKVtDGbIyChFucbP+kAjD3bM6U7CiC2IJJvhC0KrK2gZDC2IbZPioPE53fqJDRJArluEPeoyC2C1WJBaHACEciJfX9DHAk/aZ87A+Y+792vUDH0VAf4NyDW2T2KBs1CQGi+mLDtIx26ALEEdBcb3cwHqMC+WcVFfnGBHukWYd1ZEnNIHZNkCABXO9YlWJC61dfOflJIehARmopsHvQK4+WnzHrawrRP5lCMJCrYkbBCaPGZub89Bhpq7fW10AdRz9734NAWI2joFkHBQ2wY9AQiAeRT2YRtfDzr5Qfc78Ef70A0VH4Ff664lXYKAhLpMsJdEGSK1XYA+RAbzGRZdxEETnZk3iLBBIR7SG1hADyUO4v0t0CotxreG1jEXPb8GKNsEa+mnEqIQCqqSZoVZuHXv3qWBLmGu+lB2wFhGyN10eRBKHQS0VrQO0BFjCn7uH1Any8Y5KLxAaAKnNoybAgg8LCEgCBsPft/r83D0Vc2sABhBdJYlxVPoAPEGMoe3HC5k/ZiJDsJ9h3T1DkhAGaixqIsbECuNuIzmXCx6+vwiG1CmnO1HbGpGOeYWY96SEo9Hv/dVYBLrUGPUN0BE1Q5DcGCEG9VXcmYFAFVWrg1jOEciLcRljeE2lF0KrJRMBt7d7ZfKEFm2WqCLHFY+jH4YerCNCUfXboWVcpIZDWw4B+3POQ1nZCOZI8wcHgAdIk7oPwyCxunGCxloFZaq0kl1ECXBLS9rOEBDkr7Pbe6Hy6N4bh4HCsAjH1QTEAKTMPcP/YAAP5sHl/tCvuV5h/QZADfi78hbPCTQ2CsyuuDc9RmcoZkCEDdGlkVPAqHTCw3mNCwhdSiNV0ANIQiLcEsBFURbbQj1CNDPHjN5mDIwMfVOZvBfSSsBHU/BjJT7riA1D6FWy6SJ0PXrVoIZVZAfLCQR0J8A/rNUgoKZBGAekBn5BBceRnRfxdAaOddWn77BDupyHPpQA01t+pieGFLN0qcgeMCN9nPegMHF5R9O10tAB/EaqmIW1CW0dk8aLZATQ8glYauNMrHg96wuDcNpzcd3NBsXfBsnxUEtY29OeTvGdQ8LSk+pBLfA6tbZ6ArI95ohArDsJcWz76lDK0E0LeIPBbWAz+NDuFeDhEY0ZtAeWSkyMAmEyZZBxkt9EqVmzDaWEIp54vnH8LL7T/d8KTuCDFPOaKWFB8+nY/pO4ARB4meHVeGk2pIKEpZA9rekQSJMA6UFvKpxxBMtKdKRHrEKrJWC+ZNC470pZ+7lB4SoDKlRrBk4QWG5buJO1IadF2wG9C6m1gGOCUTlmVzr+EUPKYHYZ0FMtucpEdTBXNEyxSMrAXEJCwhiBArqW5f7QJBRb0IvS8HBKWGw8IrND/MUrFBGbAHZiL6GBMFir5bTleKFprjjWTZYEdY41OaMTBIfwogMFGAHOBT5LL/DCQ5uni1OAmFlSspO1BJS6d5UJsAQkEolJ+cBUKtixR3aAZbUQdLTZBPsPQx/LiA7//os0CaFPTOP16EGEPb/VId/yBwkaOj1ODFIjdZw9gCEy7mBAe4OHk7Lr3q9kCQdHAlWgEGCWa+kOSfG1iqpk2wSDC5nPCRXfAWLhLHfdIFccd727wfANubLjT/uAVH0cjHdDB8LlqTWnnDmunPoaTHEcaumiFcYBYH54HovuAD4oADYpKArhYwJ1BGCAQAGycX0B+OFYA/bACqVinenSbEbXfu/UvhCmUXb/jZvAQ0JvbPr7HmTv4HxO2A2lwRii5ZA4c1w3cv5BjNIlBSrDGKse+VRwgAIrvDNEijAUk5jR/WoDNGu24MSBA2KI3spnvAW9SfMlAcApZ0niur7BaElCVry3I3H7DY5uwEkfWCEdiJDXgwsvxQuG1Nw0uEQAA6xtFXV1oASxayUv/WAOFNxmYOkBJAbrwALuFMGU7mPIdE3bIJ+8zyCro8JFPFvD5S1BgyOXAX1GEEmRIOUpu3H9OHCqT/mmmhqAxYc2l02QCUb/L7Vb6Bz/gAP0ArBrlgokaM7AQDSuGmJNAvzjpxrOKAG+tQvlB0BMjhjH6DyELYrQdfH5GHH+1JOWbBdN7L5y3xDQSJK/bf+ApWLuUc+zIVc9pCMfbF6I6s1JW1ChVrN4AcbBfZls7PDNAlra1h0sEWQMlnyjUvCrIXaWmnwEeTvQXQ/NGPcq+dmclFwSDQhH6mBhFo60qQPANZDrmF/4CX8+SmruqDlNN+KO+hAfAVaBwcJBRPbNjL4tCiV1IN1zyFPUJ4ISevCngciP0xZE1aI5A84yAiRMO/Ty3CJAup1/YAAwBCsmDotEit0AG48VBuWnMSQfHGvznPbBGxCkP4dwGu5B3uEHb+QcYC75ETDBCEfthxFILnEGl0twzhsCEVaCTSfQE4NDOkqX2A8jccrNmDE1l41iv2XAMnpMLI9MBG7dHQxRiBEPYzCcpyGGshhSj5rBMs2bF2T3ADByD4GJKA72dLgaj6DRIMwX9BRFa0wvf83SBj9JTIahDBD3N+PFEAJyKoHZmXlA/pD5tFMcDOXvyo0lPFHbKEFoqFD/fJxvvONB9bfZuNXcH8QB120lVDMsQv/KatBmWR2k5UpB8/CYY3//D7K65xv7nE+nEoL4rMFWxMykm5xBBzQPG0TOCXFhu+0bkCmqPAQULdBAmzg/qkkAqtALvUN1HKFBzJBPuCrgsr3PgUAAhQbzGlRAZN0R659BDMqO6lI9dHMjZ9eCJkB0OFnIRtmDUjeCQ9tbCTgNPgKOdA1L15aeygDVqmDj7LyAGhJapCtiIhDw5GFUsFOk4pVLNAB3kabdFxYEuwXJBpwVKd24dw2AyCZamOo7xKCTd+sg6d4A6YaoIIDQBHzICIhY3Ay5I/PYI+FQd8Sjg1iCgQECUMUHAO62uXBt8AH3eh3Xs8CBv17riv0GiOmksvOECWQHdWF0hIH6PVfq0xGCBmuQZWdFeRYdzRHlEhiBy2y46EIOmB3PLlGmqzYt8q8BhWNvNU4GD3GzbJrBtAqH2dlc5LCJnM/HGZVBAd2zwSfzBBQtkuM62A+ILqg51hB+nPloXY0BWGt7ESOZC2eCojTxfA4D7c5U3NBIM/tMOAYD4l/SrTULI9VGVCosbJSHwRF5iUDhSCzCH9QBh/FCblVgBOib3eqzmHCVzV001+LmEg8N7QLKocMNVFdUCJbYjDsLtA2Ja6ycVNA4liGZ36hBIaL1XZa5FGyKg4YROBCMApZY9iMDGZBvk2IAUoceHE5rAD1H6G3anFsUYF6o1UE3cBPr745A7BA8JCyiA3bdvA7rrAvQtvHrAPBDEo8lgCpCDTS7hKoUBgrv6RLeQBBIbb93rODUqVaVIaSFy8hiW/nfC6DH3jHpmAovSC5gA1De04VZ5wMEUC6purkCBqwhsolLjAX1nPm/VwDreNxf7vnCcAVVwPD7E6JG81ytnHnS5jOCmOB6W1uBcOXC2fa8VV1XAtAuZEzOeBD//+X6tWA8HlerUoRKzbmgm3O/A1WdcDO6OFR/+2cghHDr326heD8CgJHMW0t3AyX1SxrDRCPW8tFBhOJtQanGdHUBjJXJpLBUD6emx8WD1C2EOy/QoAAnRGYhM5nCSJTW6SrRBBEPvovhiD+z4h9zpbJ1zkwuK9oB7nJxXKqyJW0XdeyOVGXZU/XtTCEW7OrBSXpFAFn2AMVSIfSISSCijHIqKSJd2nEmL5p4yvhFQWBweLcGBWbuKe3qWNgomsgFCiATfiVNio3D1vNbZJmUEF08TH7/OFwA5g0h44FlCONPd4wKRjU0RKVkCSI4VjfCOHHgyMmGz7B/TdYYVX8BYDCS1ZtXCtB12zoKBCP1TQbfj1Ii0j7ijNDAPqiliHkSK3zSZlNYgD0A+KZCoyDAH8mN8oMBIRA2aw2eAixSOR70xH7D/DIieODEZxKvm6XH1YwEcscvDnXf7BHcAHBRbGNjrAIkrZ8pBrrNi7PVUtGWCoNUVsmk4D3MwQgeeEAzmfah0KFAHGX0+VzZGJDZMhTG2IcGLhFb8oK3d9vxkw+AdBZN9ArZAXwJgdxOeBqoJjuDb4I98TRw/eTDMws5OMTuB7A3lfFDsARItOA/4LFLcY7WOuSACiUgAgCzPlCrFH3+GFbOrwvMsuH0d7qDjJ0DE3SVXlXMBBpyO+YL+AI8knXcorESoeUBOJ3Cxxms6FTgB5H4zI3KjDwkJkH41BFPUw1X8HxBoR7Jc4DSGWTJuiTLQArhbcpj4RA4bn1jOovA/Mm2BWwqF7jrSsgM4ABqY7SE5rDODy+k00XBUvhMzHJvHv84VwddGCqQPRhVbQCA+7nbdKKE5RXHVzdZEzXNl8vRkEasRvyuLeAfkKPdX2+BAaOrUFamAqB3S2iuxBVCZbY1V4AuU6lZTXdHH4idNHxWBcwtVy90xBnaHF8wqkD0JvZYlRQBMOamnsxHILI5OrY0zBnF8QsIrnC3iLFsC08Aiu+u9tXMCUM9SM/oJA/MAKpyDeCxM1KiYikDkQA/Vzr9CTS2mPcJQGUkPDtjH5AdI+CGW54CD7VPCsBXC6Dou46hkCNka6Ie1rF/rwgTmrDI/Et20KbEAScwfdt4gED27TuiuYAyIZ5otUWGRlPgmWzqFWP+xh2DHAqP3rSCd3BADfwZZANA8TIIvQhKAywCG0L0IA2vNWP+YKAq79w6FjZBSx17vAChC3ZJV2qPEChtiOIWhUCDFJyVIp0BeJn/rkt2BWVKj27qUFzSdC1dUEAdoUlx6+pEJWOvSSA1AJG6Rgq+xALsM61LcqDMFPC5bRzCSlnvmw9QDVzJpGzC9AgrwdtCwqAVSUOXP7zAeCeoaGsiCCwYIHcfcAION2CLZnFJt51sqkVCC2aM7b+VEKrbTOv7JAZgCTSJKhBktp5c6vIBMzG+3SFKCoH2W3jOgCcD7UL4B4AWrdbm56cDwJrtqJ6JAkhaAG2AnG+jhQFMhFAqks0DPTAAc6r8uaA0DTT/NRd/jAbmMdUA9hBWE9/UhwWCZKvMhjABDVvDT5bgXCbdHqI8DvFKcK3eofJC9IfUBWxvDSlmUoN09I810De3viCsAHXqDI6JGvlYer6YAhXkM+Z9GDzQu2nbeSAQMdu/4t1Fsszww4e7DbqPk+3QrD6W7zRmsfA7gErT68SB7/NR+5DXAC/8a7RzJG5zTErhZ9EqqlpuX5pBVbXOgv0nA2rqNMg6tEPbdpDsHQAQB9tW9hFBm1v1TLH8BfvlDBCzmHJmUX3GqlCz9+E3V+5AHGkpy5RiCrNXFmIFWK2Qhdf17YDKjIA9NSGCqyhrNUtuAElhi6SwjAAHSJPLAPCu6V9epssCU73LTRjEAWZA80mZNA6Tsb4rGnGiySz2Mu5BLXP53dB8AMWjJLzVBEFT46LSBUAg3N04NwZKh7RSFSrEELm5bNenCAmCToy4KwAdHFJfzcQLVfZgU4ICBszugAy5ZDjb9YS5k6AUssxXx8LEY2mC727KGvAx1xiZ6AYbWxrw7RRU75nQMjvCCFPGCr6ZDImkPP52pAKQh2w1EjAKwEtJH9OA67G7hoe4Bu0Dlp+mjC4BgXtD6XFl6+1RNKfAGErtZ7mTDgetcECiLAWjFKI96EIYWJATLvoE89ly5AOWA2yWv5BE4EL4ZfnAHMAwM7LZyylAasCStbv0B5bVswCmGEjcaBG+ruGff5w/rQMHGyazNta9ACVoUQSRtAR6tkq1itBIplHtQV5BKOxvMz+lA9Jm8syRxD3N2dYYxmE+D5xwYx8APt+RPgboFWNg/TyC4FFihb8YOGArz5ztRCVAZK1aCJhNA2LK8hIR8B9zQdkopgAhBeALf0PB9eezUiAGBgai1ZkSLAfYOYa872C4IxugikNFWdiQ32YxAFK0S8W28BMMe16sw0CsCtGB/2MBGsdTRCHLErhX/i1LQCgvo5byxCA/wrhwgJrDjFUPUqpjBsaPtCeDhA0kZ9TlsQE2QPoKY+5Eh0ke/YjkDa86CNJSJAPFcKJww9CNyFc6SLLA7nLuuyvcENnS8HwSoCCXslTf0FCFJ9OV58mBa/KNS7S4AfKe/uXTXE43uwxbmsCs8RPRku+KxL9xIPEACP4iiRp1wCsJT1yJiCB7+I725m6ARcAcSepnE3G64ijrQE6x82y/e1BY706zhOJBhIgS50sMAPOJsO9WQDhcAtoly+CbFWLB7kmEvtQdq4O9C2R3R2lZbEeykbtlRrCGY0muT1ICfzW0WcxkAqs3KgC7AAdHK+SgraAIUrDXayPAv8gbBxhqDPLCAuzVVGnQslgzQCH5pJkVUmbAIF9LODCxIXB8WiwdJFEuwe970QJEgfX5dsyBU8ObqgeUA9rSbmvdHAKy4u1aa5M0xKqKt5iAuyWBsMCaBOZCBLLgpAq0LLh5QLER6Dm9FEiBL+Yqcr00AM5Kir8U3fBxVqLoCXH2IxjAELqBaakfZyyuBPtXEFaD4BJ7GYM0O9C3vAEkwLHFlPIJmys9CT+b4xKl6AH9mH/Ez0HoCn5ihD5BQhV8hCK+MwCTxthTUBJpmWcbkTFsiPRzcZzIe0tld74cBYlwwpce4ETEh81pIMCvD1Hkqn3FEmR36puBAG7ywTLouAjphTMCmVFmrysZfuQFu6FlS2P2VSSJui6jOKdE5VKLI0BJixdYVQAAPCpcQHguGdEAP449jC6+OeRLLlAdm/Dkue6F37NVtzETDLsbdMB8XGFvIrPsvVCwkHPSrJaEUp0JR2t9AZ8IAHdPxBc7w65LbRB70iLBqGuE6EicA90XBSmh1ISk3AuaLGAxFxQOfHSkneKBzY3BkeuBDM1XixmddADSjoDqYhDm/g4ewzNMJ1yd3VZiD0yYaFvvvAayu+VaWWFJHEUYHezAZGgS1IlACYuq2WjCWKYntkFtF9FXeL4CjH/IB00g59fEMyv7TCpqZC2Wyz4NTyAZPiqX63TCD6saEilLKCN5VX9PlEyrPnHTRSCSZDateMpDb074IwP4DFWUarDg+IIxo6mOf5AW1GjschXAyoucbaY1CN3MXKoJpAP/XcEyGKCjR0uWrlRDpxTxa0NQAM86ttJKgA2KlELpKNAwQFsVPUOBqnBJhOadCSLsSWRqhBiCajtagIAWsPUKmFmFNHr3eTvlGBW5UVDHQANfb2SHtWDfGRnsaVvG8VxKEhI/AHNo0Qc+/AX5UEUXn/ApiDmrOzjDf/d/l6nFDN0qIaCrmAXKkuUxILDGj9UMiSfAw9hvXiG/AZypq/CS1AczKdyvkeBKi1gFGVLAbgg8zPJbCOF0V86P0CKI8AvuVNKpAasZg5HA8JPzZgCFQZjBzWjSJIB2IX54zJBHy/cPO8iDPV0i9mLzFi016m/W7G2im3T9qACzbPsM0jMBGU/ZV2J5Ca1B7Qu+nBBF9UYFamJ0kfa90LNBLImvBjfaIY4aSXfvPBFjmfLpCtFEJ5jvpP8BBouKpDPtAhi/OSxWLF3BbUNOvREtKQ3KRdZFHe6YISrEAY57yBzf+IeOZ5Fv+4Je2RtBJstIrT6kh30WC5V0mJOC1CrRLMbbg4AWcNxaxpvAVH1+FdraB9K3RtRN3CTQ8EFwRvA4pc+gyrQBtBbqeaZgAOHkWY3HKAFqAZrV9xAFxBymGV2Dy0UoIEEHARPc8R4aXB6etiIZvEHhaEWN7vYADMeoYiGxABquu9u4fExVzlv0EuGRJImKsVqG9KZ97ZJmBoXWaBhPbBJevty8xADzjrGY+x6DwO+14D18AOUn9U6GZA6q1/oRykCILzOR0ToAEOzB2QyKFhGE+CHcNABMn2wXoKD0q3rY2jVDdzQsNeXgAKJSNgBDMCzsABg0JvBB1s0mi3DGmuHBRAzSDLi3GpY6JJKDl5Q4pQBGXHfmF52D7dUhxkQjBme2V1xQeIdGa4PlxfK3CJhUyMUGsyMH+PSbBxzpBTJ5RAhGlsPnGdCeiQnm2g/AQRFv+29pBOcqWN4CiAV4KGyzMEAXdznwHw6IOrhdVT3iCVU8Fl70gAGHoEKjgFEVXEsh2ELAaHNVXgQtAbELHiD6sAhDtp7UhVLLZI4qrQIJfJ5t6kWVBewsl+TCIEaLArdEOHEQHHesbhvC8nQhaWuLBYeeLBCWdDUZnuzbVhICFQ2na41CYbVL06AhDRTic16igAFcE4cDe6AaFjYvTPTAmqKQXhRZCm0DZdt8ZBNCO/nxuzAnxtBo5ZgFUGt1+MhUFbxin5UtUFfcTN2J7xAuVVJmw82SRCBBcmKCDiV84EywkA+ncHn91tAqNGQLzI4AojvTvBKwCfbZWx53rCCMvt55ibAtXWYaPjRCtoy8tKAqA9hLlj8OsEVX5f8VDjCu40fJKpFCb6Npf8TLAnhEgVKMOBq5zl9LosDkWngtlSSHgpKs0dO8F/SyrnME/AVJiO355MIu168ElTPGr71GL+WpJwEoOoNk4AcgFbJFj4BSTYapWOiCbFI9sRanAh1kyAe9nDaONqObG7C2E5EdMPjEnwrUX1DWBGmJesIPhArErfMYA1AJaGNlhfuD53ZcZ1d+A7keu5sx6CZjfTXKzcDyWhlsBnYCfjnnbOk5DC5hxM7n7Ctyi4LBFlDCq29Skz1A1cc6CIgZD3XyC3cQ6Af/puPIlkHLlNdTXzRATtJaMqstBzoxk/PhgBDuvMgOYpBdBjYiSD5BvqKN6Rp/EJ5zpZ8+kBKyeI0UWEC6q8qiFdRChkEFoNpHKVSjKbsAwDU/T14EadCsWt5aHN6G+UR0oysJDIHxJqmq8CqFz022RHIbqHF+1sHDJQkSW4H3C2EYwMRoHBDir7w11tID/pU3zcsAb3yU1BrHDOlga/128BpqdNQy3AAUzfXdCuZCH1K78mw3AnnrAG4SnHSIR6xtG/E/xuMiBn8BnsAQac2OB8Ltx18DvBe8jN1tRBI+f5hlbUPEfcHov3mXAKk78E61IEfW8Ry1+SB0ZKpDSZ2GSMP3Xxv1AjRr7xXDnDxMQKUEx8ApDL+XHoNHadj/K7EDEL7maOsf7HYab7lConE2jKqpLs0HDUsoHTbiD0LtLeXJ0A49R4i8PmG3Jf7xw0ZB1nJg3+jBCPKVCsGXtGAbR7b8zyAWFAsHVVYGo9mr14hIDVy9Ac3rKJlTj/bcEmA5D+UemMvA5xXqPRMiAgcLNO7B7ABU+uqpbdBJOYKkiLSCsMXmPj4SX665OlW3LB1nMSOS+bCBcIIOgs/BZUqTTNeTD0pj5RF8YGLmIngclfBLdaYKE92ALwowXO7kCqIPfuLVAC1FcR8JodElIgIUJCeAlRvxUz4sBnwhdwFF7ApF+qC6pAAlouGY9YgA9/2NkFF2GnWM2zgGpF/nRdKupsCYtAHovj2At3tY1YL+DufdNw1yzAAiN+08TODHQX8CBMQDioBNoJi8IJ09ab8YtAEv0jqVq8OdLXCA70oIGPOuAe2eKQKgaQijMFL5xy8dcaGCblKrKiNB8wd5qHj5BMM4Px7CwDJjdJzEFQAW5b34RAPCj2HRsdHuGfOT67Ig6CiuRSWJdwBVmn7Mdw7It2VeezI/AiM5Ry5HcAIwxFdz0GJZ6s4skS3EEnWDMmzEBoyutrfhJBDHPccLqrEBCizrincMV7JEfhf3D43xdSXZnBaZ6HmdosAWv3kgOqELrBZFN1flAl8BbWp0FBMwd+Nn3nCSMgk/J0RBjCfBPhUyAu6yXEQjrAT5L8AOdHDJbaYQb5THm7Z0FXgBCH1ZE9D1WHiZ3bqYxRED19FVx8tBrABCxBBlDFNMvlMD3AlvIjNRRYEnNKV6wZ2A7BE7VEhNBSl34iSetEAF4YNly7AXndppWxoHR9lttoZPAtBgxQFKADUZC2ySx1CNAHh4omHA1lYPSlUvFf+9bA0myHtmuulCpYCA82dVCVmFPGHB7PgrBZPtAH/yQANrTFu/PoABAD1EvtMIa+jxEAa4F9Gjj6cKGGzas9ja00CsCV7qQvYAGRtAgrIqATY3haBPiB6DVmLO9nHNrBaNBmFBCKOnzYsxGuq4QMqxdA+FCp9lo+ACO5G/0uRBrKAkAHvNAOovtd8OdB0Mv6gc7PAlYfTxTIEHVFqlFwa3BGK5PACCsFfhcCAh+DASOiACr76C8K/95897AOJDYS51VCJVv37rxIDaHAsZeoHBoYKgxZvaBEoBFuFlrB6igOK0YcAHXqmfswXBhOS6Kz/+AA2DD1WMaA3UDq1xTDB9XI69OoqAOfQ49IuyFA5QQ8kqRA7+LU3LivBatuRMlgMBTM0KmDHSAbHNbLpdcAM/qDUBFxAkEvlB0TwB4oqDik+4CMCCu6Wh4C0UhvyTsHDNvY0Q7lpBkC9/ggFuBqpUTW3XMCPRCuI8FxFIZ8nf+ffAX2HDqJX7NflMQc15gG/5gfULPoB491/G4fODBgOJupDAER7MDdaqwBc8CLYukSEb1LGicUwAFsnrZdRDB6Ht8BDmdEgE6dUGShEVW7ATpuxBFYrZ3ZgTEkz5xLLdcDqh4wLWEiNC6CPkaG7CO+m1lnd5D0v7mB4qXBT5h17BKvBCf7q4v6AHL/AxYP3kMA9sL9Mg6B/BNMySwkAOUXf6xnoCWkmGJJ9rMqQSMSFkHBwdPpSqLyE/j6wmGK2Dn8/xSFa6BdK0FDIIyDgaK28+tQFzgbuL+33DljelZmttBa6iJW/3TCZ2CGHGGuDWijxQEOoArpiOVn4/AL44jIJwSBB1UGI5jzDrcJ7xBe5AEcslAMZaE8rw1m/o6DqyV0lh5wIWC6j8mr/CtM6kKp5vAUtpztmAPBfY1qQtenCiDa7pYE7Gb7GcbioKDIiVWrBESE9gIFcnP5CHjCRanBzEnlVT60NFAarTe63liCWboZyr6CBsyu9+rLZHL1MsmPUhBkeFw4A5kFc4kdh7GOBoYVds4BSHNP2EPBAyCzoB3FQrrCJXkxqaMGIMIKMZ5LOB4m+LuWSsBrvzcno8BAbxIpTTdwB/I/0Ow2TPUHZkKKBeAOVapR2kuAkCTc8WnCAQ8UdQ2tkC9YVJRfGxC47ZG2crrB01XJxbcBTx1bR7/1XEhmpA7tVTKjeefW9GWBr5rQMxO+AinaV8yWuDepb4NRX+EDjNPqPUOBK4Bcgfz2DoylFyF3cAYgImq5E5Coi5zit+CFZNk/B+dbCrOG9f4quEpCkVZqVBEpiQBax06Kc95rAR4mH7w3jy5BBFq+h0lpyZDWE7Syp02Ex6gv8F7ODYuVvjKbzAc/dgsYJ8Bgoe7k2HIBZJlYsEn6GyOYkBxxWC84ngv8xeFpGhsR2XuDDMTo4SUDEJQI2TXY0I11xRPV4wAQDSb+0hhAjELf9AoVB4ojtS6doA5AMV1oMZE7F1mTiTCA5XITym24Arq/1EpIhHrFITS3CID7B2jLoaoBf9XavWawFlvb951hvAvCwm10YVAJjRxJythDPKeh4BdyB+eYhht9iEcYb5Hq+3SbpwCC5AAHiiBSvM/HBEFiT9z+lJBl2qFvW8Acx3DIB25FpP0KNZ2OFQBHUha7dBGhi91kjlB8jp/rGqlDrLRdhtIHGel21lCI4BI2jRtvlGAJAPg1a9GEzZHaUU82HjjncFXaTByefIsy69C6dSuNiQnA+H5/3QknBBOzEctAxEoIYBRzPtCdL61E3V4DsPLZYdyEC6HtkqPn6CIL6X231RCGdFxI0eiB+ZDnkKsJGCrLT+kLdBpx8o46N3DJqvCxAtGGa1ehR1nrE0FcHK/Z+JN/CIzAcTAoMYyHqycArVvBIF7XJbyMBmAI9AmTbpCaHQEqVISUEZ4DXyNqsrSSCtuc2ARaWHhdbID0N9AtBCHVBxtAX1aWQyYlB/jqYnGiPJakoeOSZKAsVTtPkpeBBzEwJGYzBvP1wjGAeCTTN6E+DoB0VUSOw5KGq4wQgmVyHNzLypa6BD51wJ830zAQ49LL9OXAbUrJ3rHGFNuoNfO2iAEzRnyC5FCsQKdtlEAAAlo5WjMKAPUnyTZW4BH7zYuXM0C8dhOXF31Bn2Q5Qc5QAAJVks7qEKRwDmpUiLAXOJOj+lWDQqm6OJirAb3hxrNHAAKOaAeUAtAjNLotHRrAUzKHLVixA8X8lmEfSDXSSyMNfKAKSx/E/VBCrz7mqDtNFvF4sP/rVJVCL/ilR1GAARdZLVBAdEE/D9UdDzJgIbsGFBRaWYTHosARynO4eVQA8PHLVKekBSbd6fxSOEQQYsBQBbAIyMBXpiKBK3ijYCEnAVWTDNBfSBDfWQOv+UAbqip6is4EKrJ7N9TgDDRHUHFTmD7KfULYF4A6L6KiXc7Cr0xSSF7kC2IssX00SKceArOTcMC/X7zA6peAuW9qcw+uCCUWTgTqVAAmCDFjkpFH3WROrQpA55VHYR1LDugbVaGhADXDm19hx3AEdyhVuf9AYZzjtjJOCoI7pEjlRE93NenWELDCjkLnpqFB3Uh2fpQDB3L+4NORkBJw45uaINIJi/xYP+6Efb5kHgThAld6nvEJICBSNwdMSXB2M3+TenpA6EZFYgeHBji4MTK45GNA5NBmFdDqvW1fxatEVY+2Hy5gIwLZZFr2mGnhDcR34AAJeIEDgufAU/6udHARCUcs73nKCIB0ongup0ENv/eyx3NGNGphUIhLA1SQbOzn0CWAVjVcTdAk8aR9HpfAbaxLZrFDAcgwUChMDAFPnOmhl5EwISzAanKAPAvVtLtZAuHcHIGSSC9OsM0mcTBAWQEF+z0LX1kRiwMTA2AZYc/pNA2N8d4Y+XBp8iW5/oJAnTqzmTUDAqxpaZyTNCJt/HUxEjB4WNx+m/vAHWARhQDQDP/taXlEOFhw0lPKIUBJUJBrLkcBwpp1Lx0UA/EMLreHFC0oT/nY5UAGoV4zOqSByexNWaHFAhWvTi/s8A+lkMEoBmGC7wmksuxBpT6+8AFfGXjMd/868Jgu/km7oOEKp37EvT6A/4Zo90IjChZdeHa6WDTx3ftufKCKkTixuNUDqiT8/9zGA4+Mwp0agBNlHTU1a/JKY0RO51PACm6sJ/+uAloaDaQ7IHm1FZ851oAmkUnJuAbEcy82EWaaCIUDx3TI4BGjDlLNCREl9oQBlgsCgdKy1gpeA85N0BSCeFWoTUdGNAEnVfLDMPEEm5jxLy3LCP5yyOtsVBEOBCzrlYBAJ1PouKkFQywPSI6CAkDGaTD7YA1Wg3gRaKEPN9Smkm0ADw+oI7DMBA9QAlQhiB3LiAsFhWDO3YChY7QAu6dIryHVBrQo841O+D0aUIIpT3GHXPIqcggCMGbkGjhUDxQ5Q1JDbPfFm+NBAODaKQeMPjnAz+1YZhLrCGoU9jLDFGTJsnt8BfA5wE9iK+mGqDAk4kJBAuZoDW16yAYJ5l58+OCE/aNM3wcBCrTI3q80OrCUUdToRFS6e1rfGnAf5GxYAk/D8Tu4SkZ0BU8Aq4nVOCnIZkHEg/AYqpENjgrBhtn2U2hTB2JP+8CEHYq8yPqIGjGCK9pJVXfJUBtYQChiJHCQWta9iBMjBp+YcZFD/UY3VYcMxjVFS5EGArOA9wVeZEBvw8DDHcA62bog0MHDb0Xx5QT1EokBftPcjBNOYMKtQbEHwpYagoFJs+ZBVmklHFGfhT2D7CjHRMEBOBAGCT6ELLlGR8lQOZ7WCXk9wfZ/qCt/xNXI2UAT6o9bA4EDdMNJxAY8GJPV4SeUDAdZViaWzSB7c6ETuJ7AHNpLc1WbAYtIZBtUmCjC8CiJSqFI6qn2mWqAYnxOkNf9DEIjfRGFJDFVGM3Z2qHRkpU1LxjDWwitFRMhB11A72Y+2BAucJrCrHCh6femOftDztZ5TAMnGovx7hv0OAPpggWNcnDNWuEPpUxAxhpBRegfItisPMFXYBBOY0+CWKCoJ9ZwcdQFLle9jUKfCA5xNKbv/A5gRXfOlZBe/EPibi3BstHomuiLGeZP+MdtiJGhkXSaMQCVCe75PT5CldrFe9OIBaHAg6Z53A5seMOAF8CRusyJS6/B2tshVOE4BT6h+6FiYCUi81uzJsKGBDqIF+4BaMqVbffmCX9W9wgeMCx6Cu1/5hEsAzJpvwcEmFwTI8J3A7p+t8JIVBh4IugxMTA4GaBZD5bF9mpKhgS2BTrJpIDrlLYy42yh8KAQhNgrwUxA4TccyrR9F4gWWQk6hDBFjDxj0aD6N7Y4rL1Az42JwWCpCLLOWm3jxBd54Ywy8oBmvfRebvSACsu5ZuVJBMeu82fORATVU5R1zlAf55tqIp4BssnETSuoCRpXOoJEWA0XnJd7IEAu0TsevL+Dax8Yn7ebC10zYqTMCDhw+Q/bItBtB+3IBMNBVhiQ3oirEyP6x+XU4KItp+oDJBBd/S2QsVpD/DThPKGJBVtj+81jHHR862qOfxAwK9vcmvHGP7eniYriCYvNXdwcHEh9QOaQ+hEKtFbZ3YwFbtHBUWSQCBN8LgqQSAo4pMT2BkA63UdIpeDAv+HzjrwcC2K0eE9JfGMGiLzr/jBos9mvrFzB0CkqkqW5C9hC8i/PJIK30gfFNwEWSgtAQzaDuw+UjDs4HB2Vdx1viCDqxZ2b4OETwm0IaOOGZbuVRrMzBo570x5nUBykRyrZc9CvUgIOqn8AIflVsb1KJtVjhkKcVDDrDaFQ/LBR5l0ZlYHB8TqcviKvBE6YMuZHHBLLeXo03qAXgub/OI2AzAQifCI9BABFDqKGnEQEXBwns9DonRyS8uBDOnlEVq17DDSetG+P8CssB+VU5YAC3nYOud4IOOVi43pAC3vfV5JM1BklkmhWxEEJQrznojfKV5rfT5TrBKpmCHLI7EQIU7REyXBprNdVmddBP3dKuGujA7CHZGdGqATZiQSFiXBzjwsQViOAGFvLIMpID5cKKpytxDO6XnX92wBPYNFgTxXCjwxPgpCtA0puenWzSGXp2tlaB3Aerb5vaV5CxHM/sXhwBTM5zd0usKfvuHzD0UCSkOBtRlEB/eehjKf5EZb5P48GKArBeeiYR0CwMl1dVUeAyH+TgRyyAVM3TVF0vCvR9wem9xBTAQz86iGEqf9zND+DATEbAb8X1AJEn4DJHMA/M8FRmndA5j1BbO/LFolC8/DY4JhbN7amkfGgKRdjbDsARXzwjI9vGxS996cSpBrWk9XXgzD5eG420QiFHpnJWi/wDXZKjrkrICCsGic6XiASBkPwg7qBBhDAMvYsCNoYIkW5HCjcIpYy/0IcTxr86tGAu6Isb36MCJp4m3d7bB3zgIFt82D1Gb5eKIKAeQAkktXhBUeiCDBPxGdVKYcE3OE+UM9c/63AfpfrOxiyBgp2gLsGnByoq1CgWACJ9wjt9eSDglxR+zOmAjDM9z0z3BHFxLuwCHAjN1WPeZLJffg81jaDCBZhU+M6gAoZS9NkHiAqVBUyqqYCV9CRE1KwIS97yIHKsCe/C69778KFR0UaYR0GFAHA9amOGsJdegE6EC82OmT2sOAGrNhERBkCjQ/KIGHjAdtyaECNmT3r3CmsqtD50VrU/yfByOnGCkx0D4thF7Di5AjTDFA9V2OzGJIFJQkFEaLaEIoJP1mFSIl6IA38eM5mKyCQkLl+uBnBaLeJvn3xSobFvj2yyAmHcLB//gCdzyjssTTIn/uOb2JOBnjFCqmjfAg5RTdJMgBlNm15AgTEo5zOUf9nCtoP2hUuTEloxx5RxcBJazFFBPfAKMSRLwnJDLwv5YSggDDLQi+DjBAsN8GjRVECwFZziXJQE05Lmeq7JB1v9+qh1UDL9luXgxAFvSrI0O68CMwlWEQ8PA3jtDN9rlAZvz0M6V4A89Th/snTBVKTh1s+yFXnyN8y3XArlN8ALF0AF1BAg0i8BBTg4TmlNHez72J4PSEe5vUmCIMAw+YVTngfAlBIIyUvyAiUT70nUsUz+LgjiOIQrqflXbnlD2L7gDq5WMMc9jsEftEdibM5nO8Ft5TUi5RYKkEyA7/W9H9aatd/M8C5uNuL9XxCi2LkaDL5DE8S/fAQKALMl4vEHYIFhGceCAPFexboFkzqFnoL0BTPjHyE/42tUpBqV5MPhyXMsX/xmyeSA2Bu2Y5rQFhMO0mjT0CTRnc+4ReAaAx5Le7CGPcHyW1IaGJ5otUM8YC9PV9bM3ABj1xeu6o0APzSZS+khDPHMSVf3jAh5gO6XtmAystm7hvpExVuNoAqIB+EpFjY5xBYyDXwdvrC0raLX0EmHDBRZBxTODk2mh8E3PBrqcfrTy+EV/kRrvUZBa2dLOBUxC6FJSTKbsA8m3zrk1dBEKVIkxQjBwwXpjjalBTds+fpXcAVngjAJsYBrRgSbA9CCYvcxkA45AN6lwrib8BuzEUqt3HAaRzKGB+gBpkJUkqDIAWl0OlWJqBCCHP2V+bHSLrymJ4QA3n/QE8iXIXXb8YGF5IWKUTV/24BZGdWEuPmG8H0WRFGVARIuIkX/lCXbfw/PSnELAVnHumtCK45312iNAWTsHrkIPDlx0qty2ZAQvz8cBPhAWWksoz/3BQL0vVsEwHWvXY41U1C1o2WfJaiCszkuW36HA2G7WQZRIAwDKuKn6wDGlccSX0EAJJ1QsINBANjDmvH0nAb4Ak066DERgXyMNXXCWTKYX5lNBuun+GgkRA7v2Fs/rbDb9iSWnEJAPUleAQAvHrV2IreUdD3GsJHh6TC8pGt0AE8AEf0RUqFyVjOktbDahB7edS//AQBqRUFEeMBCdEnBp1blBFUPQUFS7BYfQDo6kMDh83kFfjuArKw7PlyVCRQ5BF7cyCcvMntEqeC9UwvbbyQBRXu4t1CvB5Xbcey/QLpF6adPpsDj/Evv6ZwAK/ecxBluAfsjo3iCWAddT7ZEReEtuwDvQAIBr6nc62fVABLDYw+j2Ec9SBvGsUCIbOawr+aCICGNzKESCUihn2YOsDE6IS1qaJL2vIQDbsLFvHuwe3TcAA78O5PSIC/ET8EdOGCOwWfdEBrCtdwLkSs/C3bqwKJCKAnrNfMvHtBMneHkuQcCMTNiMFPVCXD0ZZQEpEJTiYV2N4DBfDViN/cApRqNVYA8GhLp805prANz9vQsJhDc473GZ2CCV4x/TTk6CLFwcFpmlGkvr0NgYEAahx2w1RRBeydixsbsBcLt2NUMFAA2Akb58qB6QKZZdC2BE3h6LhvRAy5o9mm8jBNAueAvlIC8gVdgtIFBt/97rwlMHNv/mW76bK4mnlIZayCK3YGsXAoGTwuNVnRmAd9W59B10EEa2hYJrcBsNb3axFlAObEnf2QJEmbTToVc9Ac9aaOQPICiOKUd9wXBK9+7RXzzCZ0cyRMVVCxg5GGVbWB+57/iSYhEGOvX96ZtBd2QrxBTlA0N+Rphq9CelYJiQx9DfFjS3+JRDWuj9zEktAG03E76jEBZwxXhGQ6HwNFcjnEXDKkoqzGzFJwnn9zgPYE7qWnZ5bpAn/YNwiGvFBV7l2Zq/BwoCI8g0aAkMmeN78gB+FqHdYPDCWQU9FnSQBAgvb65z7Ej/CDja6HCTNBs40GVBa2Eti6nEBJVJ3l66EASgju+cs5AmDtts8EsOYT3bcdtDKnGLdLH6PCMi1//SHEEpe7OWOk6BNXg1rePuFkalxwy7DDqe6PCTtkYpguIQrVIARzgixW4+BSV28B+0LAsDv8I5MqCV+5rWnCnAKn36BI2VH9d9zYCZRChXgSinaoATbQQjkDnCZHCTPgJuAUKe1JBEVApOddVLTBEdfknsEKbAuGglHK+5CyGqgB1TFBD3Qw9XZmEhC+DH3PGCct5gtrufABV75Q4gbC+QsoJ8TPCWTgjlmszC+U9ZL/akFdm67q4j6F+4cfNVOJEb40NQ8k7DjjAVZniFFAw1Fraf7C2XXvw0RxCAi6rQPtNBi58sh46vCzs61OWthBR5BWIGTjBtk7Pmk0bCHl2y1aR9EseLApBPlGS5Og8Qg3BofsDg4JECJbm178rSDVSZdyIcLEhPXI87TyCjgfX7gxoA4t6avnZjBuvQL5UwLDouLF8vK5Aqvg9iCV8GWUKOKQLSFyZQNLdCREY1YgEEmODhufEtpisCbygiVg13EGQvJLSFGDXBru6+K8BtwhbyTFIEQVb/7enZAGZlH6K0ZBMelHINwQGpR187L64AHLJk8soMAeByZDsfzDmfMMzaf4CdJhuch1ZIW6+blFk7BIqTpw4DDBfLHqNzl3Cy00IirZ7APribuglZCpTaO74/ZFSXJX7kCrBK2zkajoCFqwSH/3sVDjXag+uKUBelSbA2DAAV6o/xMhKGFgPhokS9JMcytqofPCEBa0VSsDBYpgSCoKJBOxWMb8CLBA6Q6oAI5F9Pvwu7uHAP6AhFbnaFR3/mtMm2As+ZyTpX0BZVqHsVIyB6NCXtwhYBhYO4+VV+BcIF12kbADTwmtJ24mA7A8FbQe7CiFKqXFDfHLR17qDeNApkpEUHh9MPwdRMVTGDILhnk/d1HLUCKPB+DBO9jSA+0cAVtMStTXENT8DPmcUcBVgur8H65AWaXwPo9QCIK5l/IWUDf3T9eMWKAPvLBqJo/HwSXb5WD6FTwiEJL0fFuLyRgh0RDJKf8JwwUB7woZbYImAK6fEQ1uuM+P/cE5vmBFf6dBkj5CxnhlUo5LDoOvqREv4Bw2mFf3WUAMbRfxLohA4pLWVcIYDNfKB4WErBaYyGxIukBsnLvtEuXCPjq0yAUAAly3sZpHiA2tLa5N8/CaVNrsC/3Dk8+02j1RGNIJ1YZilFBaK+K81eCkTma4PwaAwo6ayeYyBZ2YYidAABtDt4RUt2FovcjXIqCBSGYIA54dCAi3A2luvFTBMxzDOnAvzjW9M/eAIfcA0Iw5EwbAnLV9CAUbhYhGWVDkMBhXb/1CKydbqldLI67+skXyRD2BP1vfLEFXC0pQFvuAFaFvynocA6v+ymbLVAG5mUFMKDEaB5q458YAKoh7Jj2xAglQJeem4ER3MbUGKBDrAmmLLwnEjR3TAAECB5/jQ5SK8Cz4t717y9HKBQXe0phAAJHUGe7aA+RufhRM2A0dYAjATeCIQ953qDhDFTLEunKpKzCrmAlyHB4WZeHzTxDOcKSfvqaA26t5ZpjMBbM6T7yZDCI5nlyxz6ALjyfZ7LUAqQTURaJCOtQwiUAwtBDhCR/JAABkDtC7X3LChAekXH43J3+HRmXkaBR2S+XM+FE1cLxNeezBwgyrUYJIEEs4KAUxVEtKHRI2J0FKyK4kyb7AsAG0ccOhA8WlZO1qTDCZdiy1+NCcMb749mJBT1DEKMr+Eirk5dwzQCNW8xXIX6JL0WzvxVLAUdD3fgHzB+19LsG8wLthx/VJSsFDfXHSa0KMqnoukvcGGhjjSU84IFhYS+trBPEq2dKHQ6DBzdaMPBHcC1ZkPGLtKE/H1vX+XSDJv5/2giBBCGpSNAWsKLW3EnMhVA2Qd9aAuZBm+MF5e4fCeIJKE9njAmi9XZ1x8Atj2RYpIgAcaXPrYH6AY8C5M96iL3A2A5Z2HBZPEw0FXYCzrgKqC8vGuGYc4Zr+CLCkO8JhOCIBYupfDbA77nc26DUAEYPJUVBTBhViNWJGjDYpnOHK/gAXGZv+1JzDectF4B94CCc8ACQENJbPS3inrSDlUWx7jOIEvQsjWLANJG/ffQuHNH/A35UTrwBNO0PHT9CA0IH7ddoWBoMX2ootDJdVp1FZUHBl666NjHfNN49hhkvrGBuWkf9flF2JJY1TUHA0RnjkC0mDInsn250AAQtF2N3H+E23a1C+I9GZsUIdjg3Ab/wims01GoOH6FT9TAopwRTj3VDZOuNGwYsDr+bNm77XFf8ln9VBJCbhLgSlINAiDcQTUniBcNWWsjLBCfdXBJt66FMnZIWYp/AMJTNO5lfBBgp7o9laED09YUGv3EN4i1g0b3CvFMY5LkmCha1nNkNQA2Zb0Y9bSD0cU3dyEIBsamFV1CODZpFrjlsLGImwbzYrRHgj7A100EDjIlLk9VFA7pFeJ6L7FO8ILICprFOa1QxwmHIuJ0ImVrLB8Zg7CU4kDnk2/vuZQAqXVamV5lF0FnjuxLdEO7rZkVugOxRnifk9+Do8IRhHmJAwL3c1ha/Cl2Tf8II8Czcl1QZaGNe+KOnToNKmyI07wJMI9Ow2w7nXADQ+vRBRJA8Ee645POD0ljvzitnFfja/j0mQAiosXQ4UXBo1XbtYhhGmPLxSTSMCU0oR4GSoC05RkMjUqCwI4zz1SZB6bpVW0poAzQ1iwq+aBHU2bl8sqEShDrRboLEmEwUK72MAumlmlsETClzSm8dB4ATj4eNzU2FD/hB2WlIBIqwUNdU5BcmZ0moXEPrJyIVWoYDRnDkvrchH9RD+IaIFAKO5kJGuUDbD6GxyepBHXCaYRqdEYfjFCUQyE3NB5Kz3uI7eG7KntDAXLJLUiUpDUxDgmhbyB3CnxL72ICGZy7tQm+BmHiveI2sAZNEDK83rBVH0/36zaEMILbhEAkBY01/WubGB19HB0TLGFFDKFxfc3Cc0vHvDIuAQOPjhboBCiuP8VJDXDQegfPWbdAr6llTVdCAha5BgS/PD/XT8zHtsADz4WmJhzD/NbeuG2hCXJPsP8HbCt+EdxuHmB7a8AEmhpBzlMA0ce0AIlDiE1XAAqRii6Sf0LYMl27WMNAPy9r87C0COlDztV5tG/Yrs5nbRAJFiY/RNoAmcl7XkxyAV9amps3dJwtKmLV6LH3DU3sAijHolYn7k3gFltzhMYoND6gJ7BI3WG6L1Xi9E7BgW5TlRnaAPlZQPig/CvenckMI+AGCl5ObRcDkJ0Q3+POBldht7Ae7GN+/R4ICAHY0Yc6B4vDQRAZtx4iAwqC9hDYsB7lFRfEkzBIzNWXSbTEUa7ANAbHi5fpn3YYUFqx1cPEcNCkkbzOmvRDu0OuwRn3Hn1vdTHjeGm4Du8JTHBZ9zLnLJ4Csb0k7VXvBu8no5O0eBqFyh50XyBkfte0/irA8FpLoHzuBVR0YCCOrB545jqCLtB0X4W6/deCOzMHbUhVGmT6tJgCjAPoxpJu/2BCzHlf3wVADKKn7bqsDKzii1K9GA0vyvCEHeBV3SeegvoII1/RlqmKBeIMSH0cYCSVVXsUXhDe1W+uA8tAfcsVK8+aGmDL7N0aZAjY/1xgOBE28zKMNnLBeS1msy9zAg+lhawReBbMAjh1uiAx8fsSdvEAIOykfjoAJUYKDy2i8KIl2qBuMXBfwzsaZLHCpr0qG3RkEsWqSM0KTG53OaRaWEBffcHDmiRA4v7I6po5CPwMht6iHBaN3bIobhDQ9x5QodZD81n8LUL7H/TlCPgJSAGZwKFzaRADCt33RkBCWZ0Akr2DCVOK5ag1rANrPuLnsSArMNQIQIiCFdQVND9bAyibNLbcXMBNQ2oMkqBWjC7duBBCWhRXZVO4CDskC1LktCfKjI0Eu9BteaXBa+sAMzklElIsCe64qBY8HAGljq2eFcCUJDKGWtpCgdlmpc1MBFDQXaDscAnAVlyiKqD44xgC3KCEcl6YWRn9G9qbF3OuoA4SRico6WEAPRUUlnwBGYW11McxBc9Y5QbEDBUYGliEeBCyHPNS67XDGXRtcCr3B9LRuMGcDBj1seNw96AXYVZ9ngNC+DxPGEg9ANgzBqiGhBONrcAELGADPEAJj2sB7F6ufAcOBVdSCAEfEB6C8EjYRNFJdA8uh9RKDe2nAW/oCH2pR92lcBD+M7uwFIBLkhdDOdPBNf3sNgRfAGY7nbxvWCHlZQ+cpIB4VfSIew2BaIb4Kg5XCW2QDdKiyAYd+8aw7dAY5cI2+29F+MWQfMoTAD1du70+IB9uWL3rtUBxySzDuAmBi/vZv0+PBf/B8ghPbAdFd/8KF8B7AeZdlrjCz8VsnAQOARcxo6wShDD/ZTGJHtAqxXCbAeqIcrkY74o4CPeLpAmqzAYYhIsiEWBoqNFmzEuCZDuPpX5xAkFS8Eg7MAkta6CuxDAU0KvVCVnEoGj0VqHWCaMfB2LSCFikWft9kmFEKP/MW/CCjfo/CMMWBSOycGaEwEyI6caGoyBikxY74zmDqPTao3kwQ3oSX9Yi3GuelexVTEAONnxx3WIAbbDkMJQXBHtHBJqTfAG3y1sDFcEbPZA5Xv7HvRSRDKlbBMeafR0S9A5/V8i81aDW0OJZcjOEhCuMEXE2BVe8LFh9cBWUgjeKvaDX5kPFnwSFKSMPwuPIB9c/81g5JAAxsFzMQEAO1LQG3jNA661hqNK/D0zEVW2H8Cdf3BvyJDANlox0zmqEIYQ3Mc0zAF53jho4iDA9mzwr6/CGmTgr9LDENnVMOP1xBTe8Rofj1BAynV8H8MEa6blqAr8CKH2fxh6GCWZdoUXJFKKFd/VuqfBJVnCBb0iCNOn3TJGKEKGXbDQ6BLAECF3VHpDW0e8eFoAHSoGerq/TAdwtgga5fA+VundtJcEnpPu7OlfAE13IdOmyCdfMmc2FFE8IGOlhx1FeX7ydKcDH6XYBELXXE1xH0V8IYEID1axmPTAVh5iv1V0MDFhzJW0UAuTl/7l0XApe1Teup1EBKhBoZvbEakgs+RBPEwXHvYEB6BFppjkLraDzRhoIeqIAenICM452B1bGY//AWGTMvWDA3kIG9xt34vNNHKZD643zCTLTPKDVKEeAIYI4PWC+++tWR3kBvhBbbLC/BkkhQ/NpWBOWKM3ckXBlu0HR83SB2L1V4zAjCCl4/Lxk9DV+5TLAkzBLY5IHXNTIGXjt/bWKBshcx7N0ZLrCo0njNnADG1ID6d1B8dX/Qu9rB3nM4W7CmE+/Yo/aLDEeBAy+0UPBt+lbvnYuAITk0yDuIF8XVFgpglAidRNf0FJGGKyNVewGD1V/18orGF6rJEibgYCO3m2agMWE/aFNdgsYFq49zvfbLAPPCvlNkJCFiNvjdFvE82HckKIDGrEvDnxsnEAJkBlX0uG5mkx9bOuCMX386pTXAaB5kEJpzBsDY2dmqvBN9cxveA+BAZzbQ8KSB/whE59/lBFxBnyxUtCIPnu9rxIAJ56+hRXnApQ59vzQcC4i9gzlenA0/AtOoV5FrcKFv/8PB03RB7GPmWC6mKgfZNHi19/3LviBK0iim6MZF4NFgZs3QAJtwMZdfgAIR58/yvhJ05Gd3vV7EqLT0+MiOAY4JwfjkMA2FBGCHsnA3PyoVY3VIMjgGtowOAU9zD/lEmCLxc7DJikAqK6+Fp7iEzL78dlB/CPkc6pwxVIJA+B/XZhA5wckrigCFE54P+Ix+DsY3INt0dDJKt+JP+8C6R/fkhiLIHIecmOoQC0yUbHcubGDwLVl3PhBAhRFcGQ8C4+bqCDzQCmVTbDu/sBFAKDBR0HLFgvnZlNWEsAX/55+KAkVH2eLmZAcojUTdq+IyWrgr42sAImtqn7olBCVXiObcKGYS/Lz4NeKu/DmTBUaBW/50v3gqDeLlcSD3LOHbJJ3SQUBStgSnw1eBG9fq1+POAxK7emMoZAkPt+hBGuFDXc+5qZDAGCVen8FDJPNALMQ11BjbIFCWncEvPRsq2mGArumMIbgKIbKjAStrIE/rZnWR0RB2SlQizg+DtpQ5F1KmSH/oNxZLrGpt856EqLAITr9xXDYDEBJ71o7oCXPpL6FntAW6ep5G3nJbr47iRCDBjJbEsMX8FExkFsq/nE1eB20pQtLVOTFnnxjAx3FDvJjSJqoxgByjBGaNt3ZTbgEdzOcZtwfBJ4dZB8EbAGW24LBcADLhXFPNLPAP5Fez8EvAzdcYKEoeBpdqKCMCNEbjAj9o+uDPB9uDwGlKgpQYSJRkBRqTh9EZgA3VjwoDraGc+yCeNdTDyyOZhSBUCzL4xL/4uCnNaqm7WHCXIU8PEw0HxqMv1zoVBOexSgqX/DcguOhmuEAFO7wc80xAue7ZVDqIAGl+cp5d5AAAdGkeUqBUW7CBAr1CisU0WnLRByYbuaexQBBLJ3nAeMAKYSaei1PArrHOylhKCnn2z1gqfG5sHoP3RpB6x/VBc5FBfyckldCADPOmwgTn5De8p+emWfHUtNJ9AViItIhwpDEJBuu10jhliIghUZvh7jDPxcojStoDQtM6qQIVER/ORcxcQCZRZHTwOPArRwo2Hb2Ba8RYW+b1FwtV6098KARzUXPi8KG5wYfHvPUD2NKlb3RGEpSb5ULwiDYcPRQoggAr7/Y/+ohGQGjyzy5nDYezwpj7NH6zQDn0elBCuoZvCjUL5Cj9JFKfD5uvuf/+FAT3Y56NwYEz15XKF03AL8pvreJ8AeqO2oHiBG0EL58Sd/CJddrfkCCAIsd2uhEgBlxHPtg/yAuicU3Q+6NYhY1GKoDHS26/UNeiBW6mjqTeaExXc13nDJCnZmrWrc1A1aWeYYuJMZXwdgYuKAEHP1X3wIXJ347LsbPB0KlIvkXRHzT6hX6a3MriPLlYDyC9HJ0lCsPBYTSmlhG9Fix6HEFcqJ/32jgZiqAQ6GTMle8EeIQSZkOlB2E8WFsugGcB3zMb2UAi+XcTrTqI6Czuj8KaCCHMOplQuE0uk1ehh1AzkXE0L7DCJvhiAe+gD+ht7BmXNDMM0gBji1ALCm2LyhnAmvdKy+oNCCSPccfwwE1ZKCY/NqCvvEcosZqBtpdlsrpwAdn1PotjFDfLzP8972CGKFY1AV8FtG/ekrQyBm1U+Zs47HdMTFvTmzFeiijvLj1L0eFx9fm+Ayl5RXRgUHp6wpMP4vCb4ar0zaaCxi6ftM2bDv2J//y7zDePKHVjQMDw5/sncLDBaL4xFwErAehg0Gcw0FSZRGoHCtJZyfkPL/iFFPF5jh8nAToTC9rBlDgnhpsqQoB/9YE72UxEu5bcVK2DAU0PhC0dYB9HXX7iiiBeMFlC/mHKDL/4JJgvN8Dw1kO9eBW0P2jHJPAOc0njxJbAfQjMH9ZZDqYWkgrxcB7gkOMu4IC894gvfdvAln0UkbSOBjjTCmvXGAis5LqzX6AyC7EdrtzBUrRWRlsyAulrb7NgBId2MV56WuBGlsEoErjCUzhuKuU4HZVqIr8/5CKkiyLlNYBNBEXLeatBktC0Sj2hCTDxid4HpBkvLeclBMFFm8h33g6DU+8fB7TnBWdtRh+LMICkNweaUdDkSh3F9PPBhnzmKDRPF84xVIl51B3hq4mRfmAvua+7PzeCQAkdHw8WJeAnBLMTXCECoGaJVTBw3d/TukYMlOLcEMchAlfbjg8RyIcyXvWQ0bFCGj0+AZCDCrqsPAyYBZEpcXwnCAL/7te/F3BiE26OJl+A/TBx9edwMR8+otHW1LXF00BX/DBpSoscIaQBU2BbIc9KAqEZx2tyrEOttzOKvSAJ20KF+vXMX4h24HEoAEOM6Ky21APNx9MjiVBIOiXBjpVDOJ5+Kp7pDukUs0hSaCjfjuRmTuBUYdnR+RpWXvhmKqY4D4rEjwta4DFuh4uMvhEnHKRmrtBBJMKspL62AbH9Mmq5NEbyom6lYaA02WZy7DQPs3jDUy58DOkM2IVe3BcXQ6Q7FXABIvDInywCMbR7J7MrBArO2Nt7SBv0M3f2fiEx+koN1pHGOE8XjKu9AR1Fdeo/1GEQr7+oMCAyvNLYl4KEGvTMly4lCr9mCqaLbB08Z/hu1JAkcTy2eZRBQetAgAXPFjLeclAcgBiNSNVjrHACTo7BQBTBpfk3d04eBE8dj+0AyBiy5T6e2+ALy2TCP2TGiOdH1RzHAbdGZtZTCAxOjS4MzHBAtGSHYNTEcA6iP1dVAQNF8HeLEBm4ovmM7LEqOPjAZjIB9zqKVOgEDFPGU1OA2B2+lvonrNBZTYUq2g9B7ks8enp1IRVSJW33tBCbnySm+cHG61kI9tlB1hc5OjjDEvdRkt/q5LFroNp5mkCouLFFndTKoiK5EVhUA9Z68Qd+BAdINL/cCQDfys1kwY1ASha41+V7AOnvhX3vgED+32Fx4uD4I28oE66Q2dJtq5WvCUeycWt8FM5B91iP5qE2NSDv6oXE0FW/cCKABHv/XlhTAC41YegXeyCBNjf2u29Bt/vpPDtSIHoQv79IkAIppd6XUcGjbxKhnMAAuJG1K9RtBF/VxWe6ODMdFdH7v7CS3wIcxraEvFCkfcAgCWcBfSgZsA6+faZKK+BMZSB7zZdDAmBppDySB2/JF5f02Cj2o7NpSTDIeeWxX6UCpQFeE56bAlhQ2qfaHAa72CTBXVAyC0rqJrgEjaMSyqdDH769PobROB8jZD3F17AdlLyTpExCSYwggwE9DEN3dIl50BPs9nUUWBBlEcYklqRIs93Gq7rLGjJMtJ+ndF5ebEbiQ6BMGuvuS6zEADXVI75MABNuSTGNfBniakfkcwB6xJSNCcPGLFeIEhY8LwHJ4L2HrBuXDoGVmqAXVdk78NqDXI2RznjZBZSN+8spNE3/XMgAG/AdDjxjGOrCljRiTf6kCRibpCSXLA5Tjq0P1uHn541UuahAo3WVGK4VBVuhn+0YRACw11f6tOBSFi+sPpzEyCrvMwEIBnwSoQunSHjncbzKgzA35UbNZCQApQDPAkA+AHg957v7yBYlEd+Wt1EjwhauEuJEYQ0amFlRC29+difq5C3vqNAv6RET7+WHzVwCdwHO47YMC6L8yTbe/ArgraJtYGGuH4mIgPeFnDuv5BfoAN6F9Q3yJAOKpyIUf9CGbvcVeXhAzCjUgqBGBKIOrDcjNAVSiKg0AOAoIi4zaVSFXuLX7X+7BChHIBGpTCgMy1DErPA6rFZRIEcBselmeXdfEdCFwMLJNDQLpBR5/DFZ853vWXvB1pSyiGUWACn0pmxoyBA6VpLQEXE5XE+Ii1eBwOqq+mzZD3WNOZJECAYwQNLvxCBmrSEG7MYFDSb4pYL+HqmRH4V1CG42rle/DEHQ8qXrhx+BTDFrR/tVEMsGwsssOAcFTR4zwyCjSSDS7zEAF3F05PbmEzllXeqcnEPNlVs6fkB16xIrB6JBz9D7dIeQH8cNxC5OVAQPm+YCLOHN6DcgbP1ATEDnSNZrH75MbwJwsEpaU4ED6rFu4H3HCoiGNuSMrp4jAggSO+sPEFamQ1C5LaQ73r2oBBsBjpmxwfUgBIryxME46JA4kjs41gJEFjpHK0WGRXuhyFOJDG2lcQwicBZMebRJZCBGiPZtSHtCmP73LX4iClh4apQ67QU+RZDQuJBbu0ysaLzCHVC2KsdLHDPyKtmUUF2iPW4r4KEB2iy2sONIXYEnr+I2Hzvqb/iaxAezb9ss9MBv8A3/71lDd+nRrFojCn77NxMuPB2EZpcO6jAdf/Mx3AiSW3Osn6KUAPm8U69Q7CEUXSVd6YBFFbbBayaPSD0Hkn6NDn3jziaxqAA8Djb4yKPaZsG3tfVCTCkKixj/EaR5O7lLgABFDyJLvjDRLQmzXB3EwWJgXPFUG+DTp7KNnDUZc8W21/JZIZNZO5VClSzf0DJGBJPauGheMEp9qASb7GDJbfh8e6yEQ3KOC3zjASG72U3jUGZapwYqVmAA8IkQmEbArTMwebVEARZ88KOEYD5JSnUdvCBdoowNRu3AC0rMVI8rAa5QXBoyIDIy0kTGQiAFvndK/u1H4k2gzVB8DmvtnxswXCsLeWHthMDwPu0M8dHCUQiAwLOBBIeVbSsntBa6BOnZKjAn5xfAYNhC6l4ngK4HCELzAJs9IAWwAyZGiuBR4MF6oU2CYnMFgNR1DhL5UXJi9DbQ+gHA9pDSDTnWbb9BWHV1r2LoAYAl+ShRiAjr9bpkUFF+xZWhkUCAyvhFy1zkCsTkNKGHfAtixZ/NsGDwRcAxy/JAJUt+0oE8AJFyt5kzVBmuljMetBCvgtL+/LbBJQyD7KDOBnxzv7E8iBMI9Ybab7HsU5dyNcLAApfnLaWIAf3akyOzdCQDOsNjYgH7WmHeF+uJWHI+f6j3ErOzO+0CWDaIzBG9I5Anjq+CbMzBRjTU7S/LAHUf8o2yMBkume6zZaBB2GOOoYAC+IrQxnbmCIAH2029RAY59MfuYwAdrQmWmtDFLVpw0bZDEJcdJbSn1DajfD9etwB3wnFTUSxB597X8TMfIS0ll7o14Bj8Dw0XlMHniK0d4LlJTzK75PhpAm8UNdNTdCklXdSuyUDaTlym8DDAzOOlW8aFAc//VlOsKCEY/9EGUhDNFXI0MbNITQjfgTTTBWaYja5KDB/jhbWnNCAVhI1plP+DQDPSPR1xA3iaZA40oGMCk+0Q8+CwLR3qntWCSHcoCPo5EjQg2HInTAdTCCnQcbF7gpBSkJiCrg71qQwgB9jlz/viwAC7vJklw1ADbIoa//DGG577u3JeGbi+A09InAZSlDOboqESyILKd9oB38Rs0KzIDNylbtnmBD+qV2tuKgKPkh3PJC0Gaxs+HViXAeIQnC1FmCsuif+J/7DaNm+zPWGBF3bHTt1TEXwA6J3qoAEamOBMaVCpIrPZQyOBKAcI7WUCAF4JJozFTC26aL61LrLEzSJjRBIA37rf+5V4FgXXi6JTfAGbIOC0L3Aen99/V1/AF4Mi1Mx9ChW8bGd4vE69l77qFEAlUl91v1KAJzFZ2ZYVD/1Yt0JiBAz6jJ08s7BAq/TdHBoCCRyhmnzCBHDRePO5ZAhm7DLuogAlg+TJqR+ACBHl4n0RBbwucUAHECWWoKJxcIAXe7gw/+SBjdMsNeMRFmdrq51UVGAn4gvGEDFcC5m1mfaAANDHeMYRC50yRY3pfCHHQVOy0eEmfZ4n765AF+eNY7YNAihNXky1rHWhvNkoMbB0Sq76jxmALAqkkZA/AmuirKwJIClPMnzrUxIT1nPGdOHDrxLVKJDHD8NuEdIIyJJ48EYG0gCw0dngZ1JDPxWCLd7yBJZo6nDLDHOvGzq1gFB2HyRseWfLuakSFdEfJv1DYNrUXBHvczm8K2O0Z8NQufbJUb/LrzpjAVY/JiAQiDtyWvA1HuBIMa8FMZPBbLM4wCjZBLaz16ba+Bg6/SUzUFC6BLdvOYRLmROj7e1TFqLMEO58bDpWRfkcT+DF2OAjKiSIMd0DzP6xHoLp0jiAlBgb1mLDZ9ATRnfL+o9AWWQ5qaHlL+mNctqimA1RkY4PyJAn8wZz80bJkpyhSAVeBGC/8BptQAlPhchVrUCCwKyVnVMDncqjdwTuC+BRK0ck5AAkGhTB+UBx8DTds3JFTL+1DxXBA9Or7NRvEC57iyhhMtBJLOX80wdDQeUfXbqSECzCr6d8ODZJdrD6ArDbMrwgqXYDm2NEBygXA9+XV9tLuBO3YDdEedDGcRsoVgwAj80ULxjpC7+EmydxmAWGqwGxRVAbsIZ5v4lAl9u14iBzALpJNe3iHBZVPRg46AEcO1p1U79FyuQNAV41DYT+1MxUFBTmtUSET4BmODG473DAiQZDzc0gEzkqKgaMPEQizH2xEHKetua1LL5CxRK8FqGLA3Uda0LWbHCQrZtynRAlKF1tvOGHF4jLWVQgCnkOOpdCFAHZmAchpdDvptayyuTD5zCGMQpGCnZt4KMoiC99koSWSwBeTh7HQlLCEpB+ldNsA+UrIlWUxLZtLIErT8AUfkLNlUSA2pP4qqrwCAsMds96HD4zzs1+hQHz9jOf2nrDHVqM1XkAMymy7MECeCvc2oX7+jBHdBhPzZuCwYVXLwakBi/ZQv11dAkOAKgAuzAl7HJ2KObAUHjEnC+8ISwNPsPXmEcDR5UB3kD8rQGZaYIBwoNBPCIhDJZGrDbLoLi02iUOcwCojSNn4sNC0m9dH+stHmo0CcSUYCmYjcw9hXHzGmQqJnKGCrlMx0OcDDqgfdJrtEbueUAWvxCkusr35O0KvaYEnxiRBIwgEYJhnGBu0LoCr5Af4xmDz2NA3JN6eWOsGOuSOelOyBAUs9AqEDBTf/Qj2G2D0eVuiXcqBSzUOaIRZDU5xi8a1oLtm5JWOqWASJMZ/gcEAN9aIFftHAxil4LKVVLDPgy0fPLBtLfAmx/+EbVwuarj2BSGTUKPnXElP/UCUqpICG1r1iGPDVMnh60Z1EtMJ9aEzwCOhGCip40Ee1Q8YhUiGJnmUSWloDVBGChXVgEQjQSLL8REiePiDlvJU8IE7c+qkBrCxWp0hVBe7sQpe4kDb/jv9dEOCR4znmbPYA/nbY9AJlBbe9WRA/lAnNMUqbDDA5B2Bf/PNAGOnpGeN2JEIRr7dTkBfHA02mU0DvOJBd7sxHNIppL9MvBnbFB+PYxCSMPE5J0eAiYA33ZomBLJk7KUrlEM/w18HpFCp0zhrVXaDZO9LzuisBEe237f6hFDRqpP9QgBfP9hdaUjCXyKH8hY4A2QyemA6TCf82CVDutAGzx76RgQAgtE9eEJTAFIuOWwa1Dr/HSmCY5BJCYQkfjHALuol1LsSCCSOzJJVDGFo5jV688JXO1KvXeFDSLKh+RX/JlReFJKKDKLvxq3x12DdEX3w/CFFYHb3XCd4Ea9XVO0h1B6Fb+wROsEypym7+w7ClS6t8W1KAdM6fDeV/Cx1OU+pNaAm/0mqiPeJZX1radFZBNRu2tL1KBPiqCSmGZF8taJYewqGH8epvDulDzySmHYjZBoyZOHuqlArcR+KKiGBT/rK7Rg3AFVt53qAtF6ss1yhjzClGuEliiUBwVguPv+hB/yCc/4EUFvvzThODkHdmVKcZKdB2ZP6EEUTCJ5bckamMDDGO6OOr2Q7BZBCYRAD8fqSVht/DRtYrWZCsE3TQN5AGwBr89DxOxWGhGS6Bi7KBbVgNLYOkBKnJdQ5OwCCo9qvE4TCBtH9GqvPCnwJfQU/pCsOpdm0JFR55DBcMe0IGZQBrUz6A2a+qJ170CEataxmCuGiglL++0HB42e78bwJCuBa51vCZC3ADQuQv/A5viau0h6FMyugCrH9FVbx3u4R3BjQvUC0ACSFrtK461iErTzaWxrOHAAH5ycoSBPReUDMcoCDe/lxxXeBy4u6XZhwCXcdbSnWIBbqcZT3mBEowSMVnGTGugtYrY6aApBBst/1tBA9xE3ESyDzZu8dbBsDVVBuMpxRS5iRjBegNEO4LsXp8TBQM/vwMV4FdU3gixumOxYjowSJPB0fnP6ZXLCFSw6bY6tEesK6gtQFBOy2Pl4b3EEzTcc+FYESWdzdLr7DihEeWAWHA2Dz2nxHiCGzVLlMNqEI6MoaksCB8YC8dGsxAWIQ5+TNHAEChnozGbHN1KQ2X0yByt9yE/f9EVVnDg7RKAa0GNzZotADZ4LzK/kPmGEdVfg8BgLq8NQsWBKQouOLZ9FeNahmL2hGOvHwvfUeAzzO3ckWwIEdq9TK9UAj/tbNl6YAvZxR/InHDlRq3SLW8AFZ9r0s0fAml2z3tznCZtw4vKbPAKvvDrIYzGxRZOMTa+LbipATEnFAe7e4TCh0F5MeDuIxNAA4zSo+ETBjvez3fLcFTuTOTiTiAZ/U6tFimGCEFL6guCEgGkZq1Y2Cex7VYkyAGkX1WwJnFElbprIDlgKcWgZ97QPEKP+866AUAdrHCM85xBSauyssWdFczNoNBDMBmTU/ylyWE5FMNy1LXB6pQuqnalWFdu6roYzCoGa+mYo4Cjla4zoFfEu1zKMN8oOhi7CgIuRBQpR0CwhpClQEHVPkACH/1dwAOEAoTm5iIT8A1s24DMJOCGrf+u6MHCq4iIHzYBFyuhsQoGnBmRH7f+EeAti2WT+aHB7zUCVjTYDrtnMUiG/BPI2d7QMUAvj77o8/oCR956LXGpAjm8b4ys1BnVzB+UV2AdmvItDQZCwp7UvxVjAImICTGAKCghXgGhfCA11vtG37GABCHMDo+GDUL4UOSVlEsBoVrjrBGpBsfJYQKDll8FeZi4HLHriSUtHIl1PX3emKBnNAXSxvaAt4s4PgycBCuqkDSRfAQWMjcl0DB15ZTfDSgD6B+xnK+eBgh7JqJhjC/8vBV9VfAptFNXjT6AiCThDVCRCvDehX+vSD677EHJGFFi4DkhB7CHCm+zwkdyCmprBpLMbBRuMFmq7oDPE6c6PlHA4IQJ5BI8Etcl1z13+CwVVDOVP+DYgh+qDtxB3scnYvrfEuXdVXYG8KE1w2HVAXBNwO4w9z4F7jeQPjPkDC5eAgSdpCHRo+owKrEGsmyE3mgBMm8elCVmA65yx/9QwAhA2zOdP9Cxkn+J8EVF6AvYQkv6Dv8poepIMLfy3nsiQSAnmW5fxE2BJhSFMklwAQbwXq+c5D6DDQrMw/HCDdGd9WZALOiYNOw9AscGmwzwiDrh1WCnGCBpMw4Qic7HpuZtEKclDjFkYYAEtEg53XU13OBDbmTwel0EJfHwxvYlAPEPxX0V2CvHmzK1tvBZcUIkxvUBXjRofQvpIc2j6P5TfAxxyUgMuXD/Wb5tIhpCDVl8Yxr6DEEhscSBVBOLOTk9MaFEUermRV5BjBl0ABdrANBqTxEfXAS1/9BVn1EP7RnNNiZA3LM04kXFCpb8gHvxeEyyszA7qrEdZgllIGEBAIhAAhI3BiiaHa/6YE8wntMpbgQZsLPmIo1BmLSqH/aaBNyfCiYLrAKaekPCbPDZoZRQpLKIowjzS10VCif1CAUD2AW/oB3gFVJM5xia6BaAMxJDC5DpAr3xhuGX3GTjjB+6cFCoOYhFv/BAhBCM5VwzD+TVrhmn1CYTdtBj4TLEqxCDRgYAVxrF/v4UCIeC7hqrjDN0l0uuTsCiE52dWgtDmf/V0mz4AmNAn6Uj3FzZMJzcqcA+a9ZzLr0ERUrmuXJADoYXcmKvSA/vjxSpEoGg+01FSW5Jisp5x+jPFxvflvR+DC+kdNSCQbFPHvWa1I5GF+eiuhrWALmfcvYs2CGQfcVMqBDmgRS4IKwAsuEZqAu1ArTXx1amGGN6Sht3RECpuvRQwssCLlhzZbONFm5fflMrRBg13nWHpOAcAJ8BmZ2WvtCmCPLsBfbsrup2YAZg1jCN7rBQyxOuWIPDcu54A0veANmTw7G0SC0CpyuBVsCZCeYY4vZCXQtIZ40yAJdyOrMvLGQ1txHeSYAd3IcNgacBR7S9CQBbDxkOK6dybCzyeYYvOhAX5hpVvTOG3Q2NHuj+E9PMpXoEgDfXFRKPCTACAH3ZeR2DiByG73T4B1kMF2YMbFcH83WWroHNNQ4l8ZTAf0Qs50bQGFoW2YcJfEpa1M2R0FE57DbzSYpBll4oS/zvAla7Zj58QCf24DWqETCmrhRH5DiPBrm5BxGTObVtq/VGCBRQY+8LfWIwwtVQ1jQAH2W0DPtrA0tGE064OAYhpSVt5RCGmjlkiy1AHnC8Sr6IDFXDE1HO1B3h+Y1MFgBtTnkDmqTAXyn7XhC8A61IWwIMXGDk5haS68CP4DDZevUCLWG8Qe/0LMtNkedQ7AKsrYaWa0NoJzhZZ+3APIMrsUi8EnIza54MIDkI+h9WLbDNIoHwRI5CnuIOiHfBHkZnlJl9KEKlgchB2iAuFRgmeWrD9XKHVQpgFS4Rag7ZgFZPd2sWCNETPSg6FsMBtKqWI1dmDFhedm7YVCSdxkeX4IEvTy7XA8uBIBrBSNkJB01FUEJjhDVc6d+ihnANzRYL8y0EfKEySwTcAZzBGlOibAW1rfI6khA/3ih60E+A7CwzqX+sCDUE0JYMeFlmTpX/w+BfyzZutCMTlvyE1TzKAF4HX1j+ZB1CuHchI+AKzQkqNw2Bvu2QpAwlC//FZdwa7B8Lnxq4jhAnamqA7pNFpJOC31MECr/Kalj3SCuR6eXQm8C2RFsFoXxJxiGgpmc+AGqRJbC4lFPPEBoqw2Dt6A/VJqfFzno8+y6eC37QhGNK8EoLvY4+giB3IVDdfF+BrugYr2bTGjsjDZ82bCZDpiE7iEE8Ubqga1lDkwpiCy0rBptSJtO3sApx6lFXZFEBr8jIqB1AHLy7NZzpCp9iwevnBBm0zptViwBBT9xuazACGXFeWjskAF4mAMC9tGxawjMNQmBLEHUVWjRA9GSOzuGlCMoJl2R2PJCyYfuFTzAJum1T/mbCSBkkng6OAG9RR3K7FAU4/NHPoaAcOJbvr84A3Y3EpPEXCoJhDdqobEfIWFSV2JAQrPeqAkzIySIqZBuiAO/TLU0PxALDnFp7SfA+pNUpi5PHlDddzvMAJ3RkajGV9AuRm9n/TPAFjAaWXG8A8KqFipX1CXjG3YzmHAwslEfXojAdWlS/h/wBNk/gLirwBoaUJBFGwFhSqBRtuaD7Rto/EHuAT8J5Mjm8Bfc6cvFxOBPNWZ/cqWCFJggXL5zGUoa9mzJlCi2GZfIu9AzRixn812EzD72uk5FAnBN8HDDuBBTGpSaWSKcJIoCJprA0+RcDiIdCgcKtprxjEOpsAwLh2Bt6/c8kTaCYoT6elqOFeh4Vv+hxBrupkCAG4Cs+If7uhUBft9Pfn4wG6tU1wXvACqSFSqIZMALCqxrWuYEXLc0EtgGEv7AcEpNGNbjUWxxJDI7FSnfmyyBTTSKCK5PC+y8XwQ7fAInNCG3nsAwpn1O/xeEso6Z2l6qEhqdc5ZauFQQ90SFHQF8ehl/aDYKq7ouE09zCu7Dcq1EmBDxl9Y5IMBJT0zrnjdAT5XV+rcMDdU817if/IWf+FksnLBDqXVk+nCFzJilZUo3ALL1HJ9ALEdHiDaLzCBa6ggEGngARdafWrBrB+VJfByTYDcdJkzmouDByp2sBUXAGvdnQMNfHBdDfNq4sCSpYk5/C9CF/+iERydBMnj0b7VbFuJEp9yENDLDtc3JogFWBHcUopxApABf5TmeERX4x1MfJBInmpYx/AD29J7Zvt5DuXr2naOtAPFEjorOxBerwxUnqoCcVQZ2qWXFc1y2oFIkA4ND9lxc+HA6HH+BgABZ2GjqGQSB5XN8dYAWKngK4t7ZuCudt3MlhbAVCRGE6CKEkGXH+9yqEI23XV2C5F8+xt8mFRF1IgGlex0EnNLXHvRNA36Suq6m6A0gJpjesbD/DQjm6A9CXONx7qJPBVzJGY8ozExsIcmtNJA/yst+uP3B7mwEe/YdLxc3v9sH/CvA6sXArSAPLVGiJcCDzDg1Ht8NAr0nAcrChCmZIFhPFqJScgC2SRkAHSGKFm5NB8PzYwJN8Dr5UtSZN0AtQaM8s7KF/KjKnHucDLp+c5R6TEg17LHI2pA+xO00P65BZI//ltu1FYpEvP5aUDoub2qgO6BKW0Ym42iB2OujSM9LCfm0FR2QND1UQ/K5kLDKBLU2CU7BUZdUsEkoIjtzh0XfEId3q+kqLqEvB4MZx8YCr16EOZdEC0DzigaXdI9YUS8djdENjefWdXMBWs9K40uIAYQ5o9iq5An6QkM2/AABEOkBVl0DSq/+UB7+Aj5fJ+P5tCQj5rZlK/G3ND5QIc7FA5U01+hDDPwwVyIjXAhEUH6PXEFadxsXfqAASrrglthbDgBM7G8R4CDyIAXWnjBQi+FmLT6BM/jBKg5+AAq8XkgibOVqwpdJp2BM8bbF6SRCN+J/UbauA3SEXHBjPL2d7yVTGEPT5hghORpDS16iYc6vA+9iAuAVxLUaeIraf+EomPGO+N+CotnfAo+yDdz9PmKlxGB7Qv4lzmGhIVzNRzSCdatMe976CyRX509eBCCwes0iYUEpEkg4tNsBUqq362lGEi/t48sP7J6YK6MoqwE+ZfIDS4NCAr4CuMzbDzDm9aK3iC5oGGIxfVGP4nVZMYuFzRSFuOO/CFm8wi4+gJZ5KIqHK1CGl816iapGKcb53LAkCkDHG4sfbABL82N9OOLii1f0EIeCJ41/vfTaADgrcBjUhDjQNIFwXXCb7tkG1QjAlWsb4cGNEqdqj7HlUNQ7idumFyBKHL22wrrAD1Gu7ZzkBGVtHQj5VBkAKHasA2CaVf9Ps0VJCgliQ84EQr1xJ3T0IFU8RIAeH+AsuTJAPErEmshMCTXbBX2zMwYGeA//GG/GqmAqczCKYquDlRuT4lIHAlQCHU0a8EnSo8PtgwBRHwu7yz1ANJIG9cObCs87NOZfJAKpTBXXG7FYVzqfCoFBMPkfyQ/PCzjzjj/TMCo7yzX7yAAZtOYteDoAKHQSgbMSARVCs2vErDiu8ueESiErHYCG/3aGbUSuDZsRC/Z3v95w/AHnY2QAWYHMUj8yq6ECflAoMdCoAzysBbn/tAR7kc4vsZAY7UQ7zKHBNs7yPxIVB4iw/fOTcDUTlhe6/NE3sQAJpcoKVAxv2DcsAdbkYXQg7B74d/KzTAArD31FJFTCOASXPXD1FiPuukmOnAi7GFgCUeBPUSLbLUQKZxzVnJEcCnjoXgv2rCfDNLB7iOAzEd4LduDCGuuq++2gCB1hvXKgIB3sDYNY6pCLwe2ktXIC/pjDqkyXHzyQ8h7zwCOb6HzkaKIFzc9WC30AXVfm6uPrBaN5SMs0iB+Rz5rtqPAzvO8pnU0DBm981uKEDYygGKYc5AQOUdZaOQA8lcxWC1UJ1fzuLEerANLuHf5NXGfIJK2E0lE8iaJ5K5iAvhevhFVyAs0rU4x61CHSU9ig/3DeRlre9WaIbRVaFs2BCwbvUIxhxGHaRWQ8dPBZB/szXB+B2zyPIRQIELA1P4i53Euil6L2eyBEnG+ixx7Bausod4QAOAxoqoWniJAk+6ijxLF9zOwoOoVDW9BL9Y1MKLLgWHYEMB0SG4DulPBektDgGx5B64HXOtmWC9G+UaGyoBjfk2fxVtEmtx8gwcsAe1hrUWoZIkAXNDEP5GmLCwC1LTBAlE77UiYBzz0E2Ai+B2PT1yAmzNiKweyQtXCfoCHG1j1BdYsysyh1F+sbRCt8nA7padp1GqAPs8oeqxBAuFYVXfUWDAQHDyAoYBQxNTCq0GAg7mGrZ8cAywgvUN2GKiBcRknXwCpxENopmvAaP00hyBxAFl0ZTjv6BmYNCTrkBBEhvk7wGSIrltUE7yzFBn/GdwVyAyt4h1B9TF9DG3g6mCA+dB8I22rH0Li8hM0+C9VeQ04yNHXkaf3n43CDmn3gkPcAx1qctH3aF+oj1D/oeI4LUBBLKiB3/8PyGP5A2+2/lHQEAYMq8qcilHhtVAuS/RBxdj2uDdoAWDDc5b4tBQU+657sPANHxqzoNXGDpfW/f8sEQ4bHltHDDUtolX+bCBsvYVFh+yRLW9rtKW/BZ2nUralPABI7UEdXIJKYyj/MVdJ25Uq9X1HDUDrhFmbbBCSlPfj7dAIap3wxM9A5BMtQK5jMyW6DF/tSBXwCZjr+YDyVYiD8mrBNAgipxY7F5qZNIvFlEO+zU765eAWfFiA5xQB+ToCrfinBGlk8IYXKAjQk4E/EjA15JzU5yCJqfOmRx2FEkMaKWuDnAM9WFvVmOKbYr2H0uCB9uN/4ll8AmkzuThAEEv7ntdHuqA6MFsVq8oDb8aGQ6CQBh03g+n0tDo27MFKP3BZiI8FBYpBEFn8tXNjAGcZMwfjPC2BseQGQ/Bv6oumQQ3AKCftrdy8A+M2w4IZjDBKEeP1pfCeo/Ii9xSDldTPs0xDAzWiFmtjQApSNHsvFrC0hpfrxxPBtAZEljz+CrdDXeT6zAdgC4I/3kAyzJuCzWEBK44OetQyATkJSu08RAUGzfgbUaB6X1PDPJ7AO1Kh1/fIB88aQLkEHDA6H6L8rmAK/KifZwxAO6MO/5TAEC9ufxVvjBEtU2K1b1AAbQErrRfBIl0RrYGAEfsLUBnMbBlgDN1vtcDjEzNtsvuBTggdhBf+CkGmga13rDODS4nZbCAjnesKvdMGouomAGVrBUKUOcg0VCm5HLskHSHFBwhAR67BtFNEAEesHWWLyFixXDoV4SbaKvB/SuAEn5fBH56hbpiaNZAizv4jqAVc0fiLkXBaTDRRr/2BNfKA1nSbBriK3efscGqxghEDbLC3Ra22YD1BAsu7TnCRAzXgX3X/uDUV9bB4IgCmm4M5JdTAAwP8sA6/Go0KmdF7eGBpWKWzasLI4qplxCKF9e6UqjX3GTSttbt6XAARzXisAxAPpNSV5jhI7YO1GlJjAUWpegbmmII9H8CW06DlR/cYCRVDlFZk9JN3DKggzs4ZnBw/FjRU9qBB6bBb5h4BrsRZLG5tBnKxugGliAGmVFGbfxCQNquHtezEOHcazTTUCib3I3vumE2h7PYu6UD7E47QCdDDOAnN41CgAdB9sI8SuDfyqhfCcLE1Hz+CsruB7ukksjXcAL7xfvsVSCVcZF8XEhHP/1yLeU5E0t9zWbhNCRoFkUw9/AtU5eIjp/BwcCjFHsDKwTx3VcGzAJKOGzywSClvCdjvMSClj2pzzyUGvS7sOciiAZEPp27W7DREflSeLyHDqk1Kp5/AUh9Bb581DalyE7DpgA2J6LEt4hCUvY/1ycTA3Gwpz1FtAvNdBxRa4B9ms29V77FNFsqRkhwK3d/0JO7qELCvNKMRQDpaeNQzPOENwZxbTpdBGTc5dL7QAji+otDvuCHVrRNXP3AVgDbyK7xAyol1ND+SB3M+GIwkBAlCAX1bfpBaiCER0M2HHrUaZ6+vBZjgtMcTbCrzbS0S2VCD5NUy9mpAb6fkhuG2AzF6uNNuFA72wzlANPBvCoP/01bAK3cL3jb3CYqXEosMCAFBdcmUQFBhEJpWA9QIRW3AaaQAAVIKMGhj/ICG5+VkXJLjIXCHe9bCGunA1HGpBauF6MbsjCJT0ncBY/AdoeiwFTIFe0tPMzkQG56YZymE7BDDYjtMvnAmMzA6lZlAhcJk1UmdHuezbdYItDPAF8NNjVBLUhpKdjFB0D5zZXhxDkuCKhYNTAeG/VN6YGHfuXl1NCkAcJ/xjmr7EFcU/eCwEHLd2aozfZEUSzVEu+KA7VVHzNm7A0xXqQuQlG4efDmff3AcP42yjrlBUulkFvw0C4XjjVya7AbK41SIPWBNDe1QtJvBca/4jlhnHjVL7D6R8A8nCm0FrMG539quETXCKhzfpV7fAbfqe3sfmAAatndrUmAJIPw4ubvH8fzYek48Bs9fSapbhDbJi5C4coAJHxjL1LwAQM/PrjwqBEH3fU/H9CSmSiqFynF5ygbdot+C8iycDq6DFYELXAkvJCAfkhqYWvCa6YmD+6zIdMgNXCcEAwgI+4lGzF8dTySU2WByRM+asUGIIaQm3AmsGTTn9txHQHPZr9JQdcA5H8pHalIF3hbDCxGjAc4Lhh6ktBWc87wBLdDqbHrts8YAt6COjgz7DAYcVL8DFBRUAcqGtcFFIEViS5ZGi4DS23y9AdJo5SnVtAlKHMyai9JkXHNC/KPI89wJoqfHCJljrIx+FATvIlKdBFJINVm43pDA1W3lPvfQDTp96GCVwBuNRvYRHfPpS8cjYT4ArN4YUJSvCCNFZwon+DOEr74z8CAYlBJ86q7A8WCFRMPkCO6eb/WdjA0BAMTrqCS5rkzngZwKYrUIyHb/ApXnxky0bA3KEM37xiAEofooxyACYVl4McMhN0XC33kPbC0XuM6ChKAOzOeRu7ZKIt7rCNOWAnQHfWPvFBDADJnv/UASfATxdPmEohmBFhLgBH2OvUfNnB2mHEyk8cBpQtCpE5IK2rZXRNy+AFEl8rR42GuHLrLuhmA97+9NudkD7vPEmZawBlUmCITDAGkYd/1sozCsnHOqGOiE7Q/f5G6xAbna9FK2rC+SUidYf+CaojdMjwjBFjSg06+UDM4R3LB/nD17GM5Pv/Cj2dd84vgCe4sLo+HCE8fn9Mo5iB8doVvuihAeIoABU3eB0q3nH7nJKDE2dR9BjDsN74Jy/bAANa+/b16C08WvzynZBvvl5AgewANuAFq9HNBxilUmLZkBkq2ilv4vE1p7CB/oZDh0k5L+J5Bp+qYBhY0AIoDCIQCVBLjmHLORdBI+agN4i9Ad4nqJDgqBzg3PH0cJAxtTpl7I9A254fahfOAKzmJbObTDTvG5x284AI596tfPtALih1sec8IFHcEM8MpAELO9+lqBDhYFaLhdwBADeeT2mtAxS4YDB2AFWNyDNIHmAhML2w1uoFgzbTdjYbC6SPrc8ZzBNa/U3BoVCkK69AicBCOzcoZCWbA1UG4gPc1B4j8Sc0lgA9/aBTuqXEmJ137hPyD2xkx5lJdAEXJoxz79Dqp42gQxbA0E3oNIdrFhuqOKtdNBICh+yNYFAkBGJrFuFFAqEYeaWkBztp4OWfGBUanC+p4kAUFXtuk0nFNehI8ZrdIAGCq7I4YAMiMvzbq6MLYgKnJNkAi6C0uliiANZFY8blDJKUlNFzJtDOpjTBGLNC494THWVWABF3eAjsBAcYs/rZfJDRhm3woKfB1ksyigbpIyzmEWbWyBHJsg4hfLGzDyh45eACopIB7w1kEKpeaBAzCDd4DLSq03BS4dPnV9mA3I93s2WdEGBTjeTm6CShGMzgR3ASmlMtxghAATEc5ggvCnwc3nnihB2Cka7QDkCdh/sJGxCCHhM/Si4PA2b4y1j/gGxj6GSzEfCYj2rCOeuCAfAo1qHwJCcIPs6PDEdSOU8bj4D1tCgAQJOBLdZr+zA+BsI6ulraYASVdECEpDBWAmP9ZKUAk8a4/ag5DiQCrWxOtDS8UbwMJDBOBzrNGQ8FSJx9bP+wAo36XpOMzEbkM0XfgMBvlnyX9YAG6IkyUjNkDOT6jObN4CYXHNhx6OAnB/J9dlpCpZaQhNOxBu8da5cTzBWafBipKIFnM5oMIXkKhsLMKY4SEfezGgQcpBpUB0ASkeG7GNqyPBsF30EyJeEOAX9m7ZHOhD0h9yTw/+AUzvypOG8Dcmwu0fe/BaJKO2U3pAFrbDciXoCTPTXYs8uBb1hQ7XKfFQyNhRQ3NGkdpPszmBGb3efcxceEQqjBq1gzAL2c4jgtvKm1jRI9MgBHNQ5aZ+LDAOJJskYWAJAORozX5A4RkwyovfAPVDdnCTMEdoRmZTqvDKaeHK0HOAX9ZKUuuOCXWDecWXmK4t08/Vp9CbN0ay4QLCn5koSPc7BxAFePIwkB8MtIeLFrFNERLj8BHCW0FLgJchAgT4fypPlEkb/+ZStXBQzYSXlR4APCEzrHx/BHWO3B4WSAnMh5oKWvJq3tbvLOmAf/WflYCQCgNsqebzLA3vbmInTbAX1GkuVZuA87HIK2lBAf7nlmYaEFLnAqGKgICPfdTXxl8C3Y25pe98Ez9Tf5roPCg7vJ0A0aAjIBmSkSyBBOBWKecQAo431ELvmEQcqGnnovF3DhkSbaqFjV2p8bUeEF2mmYmYcD7a2FjCzyB5NLGnKP1BhNAOzYEhBcy92YVUcBKSKgAsQ/D5YT/VjFEIetdFA2Z8CPYne/kiZDinMS6zLBDVdCwjGebAsljigv7BAdidclWvwAfPP+7w/KKpEaj2u1/BWWsB2EvrAKM4gpM5sC+4GyTTomBDAwsan+HASTEJlcKmEEXJD/9geIalZX/i82Ap6pkNJx7Anc6Q4gz5EQr77hm80E2PoVg/WtA/KBVyw87AlwRsl5y1DAguvXhD1AZ0SHthThAtMg6hVyZBxqP8tKTkFCDjMEBG/DzypM9ZT1AQ8eGVve/Ewx/gi+FpB2arn/SdRDp8EwF2NWDLDmLDuLhHhqRKo7cjFKAEo/1+iC1XilQ7mKE5lm759nCEbS5UqfntCW/0CyYZ/HWgUp/HT8QvbMoqFloGWTXyjujyDcFctduhOGF6Ix+XDqERbmFHTZNGqA+46aZxBZNJEYDFBANUa+EVJIFiLB7inGNAGX9xGFR+G5j1YET51CdlAo2WuzAatE48vZABk7N6x5loEcTLBnfOhIwoq5hOB5AxVY709GFGGA4MyC0rD/SZg/R8GBf5doD6NXCJ5qwMk86A2m5fzQ5RCgT4HH8zaBL0uaA2Q5DAX/T62enBPGAS0WiqBcUjzo22DCmFl0ZoFKBn7TxVpb4CJRtT+Rb/A0qLEX+JHAs1U/3Uj+B2NGuM4jFAm86CywG2BAHo/wrzgFLYolHs9SAf7Togv8NAqZxlL75JG4t+a02NwDHGl1olvwIyNUZVaFCA7gIVOjU5ChvGP2ExDFR7v6so2sBjErZ6Ak3AL25SsjSvEI/vyYel6E11W7R50mHL9qdRkpPACFLQnFpeCS7yN/KFHGuzOB1tPlEc3H3dA+TCR7+dAWa5BO6WazYHjBEtCPbDmcAJogApXccHSgjqTOnHBFGroUqx3Ae2tu7U1JANcULMYoqAGy568SQsBtDtBw6KTDGR51pppsAlA2YwXkmDHTWymleUBQrJIApzHHPrOGLy6hAs8Pk9INjAbh9aa4wdMvoGMF/H0IfsBtx4PMFI5X84ScpAq5SNnG+eCuBGCIvozJWhjVfo0MFHK0pvECiABhH2YVj9FIbUwWon0CTg1jIw0YBQ5ROiyz4CJSiiWYAeAZJn8eS5uA+hpFR5drAq0AViD/oAF1jgFmGHAmZQ+79U4BCaBXLAVRCIPEoicY/DzcxumfG5A6dGTy1v9CZEkNjzt5GKL96xHP/MwnxSORfvAL+j40994BHJyu+dYaC+oF04eanASXfpWohCCYBgyYRlqGjIrtv7aRFTLCifFleDozJ+U1RQBh0QX5JWICzba2sdQCA4kJkcnYJAWbYdSik4CkjxDV4S6ErXiroFXOADu5eXqQ6GpuNLjkG2IDLsqwJfAB/QimP/tvAch5EiL7CBqp3a68ejJj7g3KvSQEfDmla7OABev9QvDrUGNd1YjmwmBjyiHhN7HGwUqdflO6D3uZCfn08AQNWt1aflEdY5/FQbTBsulcBIXvAHNY2CnS9AROcgG3ROAcTL6dfiNCrqo/gSkjAi2AMmAzOCT+sXCBjCBTe4j75meAom03ISbNF+H7ZlVZVH4nUhgGMfBSCxr8J5tAEqwR38elAmwQzarslBLmHdwnBWAAXxQdxk1CMD4CWrYhBFelMunIJAkq7ASOC6AdIPz9NtYAHWYkZXroAbtOWSa89BV+rqGycSJaIQpRFWcI8zwcsHRQBK7NOa93dC7Gsim2WoD+tLJq59OB5E9fog/4I/aKP93EvBzgI5yiUuEjxNTgeGoBv1rlETX0F2LIcml6cBl3oRKMRYCJ725IGYoBxXCa3RHSBoCby14nUBwoDOV0vCDikfF8hH7CCK14il/YBzYLS3LbAFqsL9//94A4Z5gqYqWEI+uvucriBoznBxPUXAVgx06MtyD0dlmg0fKHUg1PzIi1AHBbcgqlkFbdJPy/9dAuZpsBHFRCP3SsEAX2DZ99rnALhB02qxDnMZFxuBo5/l7Lldy7kO4gBjMhB1wwnGGG9JiHMNAgP3zuoewAzmAxiK1zCaeT0GEC9G4TzHbzoAApwsjaBD1KzqZzUYh4KfXDWS9TUDzMQnR7OHGjoA9sEKMBshaFaQDgDQAmaXi+xEAvi6KT6GAcffMbFYNCrQ8OUlBHEVs8AgwTaNQzOHWEt1EMPMCmWpEDmIBQxOYZO3ma33arPA8xOphB1XAT8O2B3YHDYuZIpC1OC3+r0YhrKAftKkVsZyCjm4JKOE5FNa1RwEeNBVZE0mdJnBdQpfmK/+H+FSx1SVkA7YUJDkpUAPZXzNjBGB8EHk/HRuAOXX8+JQGGRVD/oKPqBefO6vY9FA7bOhNy99DstT5cKF6AeeFDEpKJAtb207fS4EsO1PVeMTB0T+M1IG+ChFvcfgLGED42vdYVMFsn9OXc4HLJlQyuv/PAMlla3Hw4BggSLGvEYEez6p8fS+Lkmii7fF6CXhe/l0vJDQshZphTHCj1RXaP+4AeCGZxpEZCIDHMZyP2I0i6TZ/+HBMC8z0vgNAHLsHr33OK0AJLh4YeB4oF4encyNAChxM3iLAjwDUUC/JF53+PqoezBIZQo1fXIA3AOTrjmDD0LK3ErECHNDZT2vwKBAZD+NIJ9BPFQLR7xSAvpt+ee2QFTmWUcVvIEMvQiBuHII2NmoAjgBEhUiLsvmCBbi/q0v7KFTvNw/LPsCQ8NEjLV/BhyuIYLQ3NMeCaRnMXHXQiuv2S3AtPrD0BfAEhu9XjQgDJjHIyNMi8Bio+ez9V5CEXMHz9EgDijH2o1M/E5tfZB4DZG6UfRKdjwBT8QFrLSHAo26HjLzaC0pL5kS33Ed+WUf0/fAJ1mU6GZyAeHB2oLwJDS807cyJ5BBXVMjPJnBqWMuanmsGXTBEZ0o5A2UjuLVC6FKw0lbH3eBDmEq35drCI0V54WWgAWYaU4YjJGsqOYHuxhJailc3HhCB/VQRiZBYA+08npEs9AsuQcFgWiGpSJUUF50B0qPcKYXPKpvQHGwb6EI/h3b3hODYsdfTOcAAG5yT+DG+A74gz5K4YB+1VqllruG8Yf2PD91FK91bcJWyCISwtfoyvEFwMYEpFADvCOOKiqoBL2FBpXyfEwXvUMTR+B28NX+/7nBy3q0R9/ZA76eDtN3DDfx4vKZkLC9T8KsyRFCDJAVZkcGAu1u+LBueAFptUp3yAC3ub8tBOoDasAtOxaMMu9sBhg51SFAdlzfcNBrpl7TlztB/9IO75GPDAUT9f4WQA190HNB5OME8kgzuRxAgYVVMT0sDcjphT1hrCPQZV5NfJA4Moqey0/AA+yq4Sd5C2Y/lF07nHxgo+oEqsB5oMTW8bQANUI6SfBLD1PtQno41DY3HfiVpyB3ah0UgRqPN7H9jFhsBxdUkRLKAAn2QyvNKOChIllAAxJDsfLqMDaLDfgQ9ZPSpHAyz+CuR3HuD/Lmlp+BxNNUBReeJVG6uAAOAEM+DqYydGCR9gQUCRbFjjb7zrh/AKyA+Ji+DC40SWEtkFAxNHmnuQ2DKHHBI+EZBsfuJG+rJGlhbhC6qXIVyW7OwtqBp4hi+KbaAL5GZ+caZBuBLR9D3uAdvq/wxRtFMci4rdp9BapmwlPS3Cbi1vmYSyBzKxJnfHxBDDKD1Qj7Av+SItwstDrMKmBl20EsDJ2TXUCCM/pF/9d0DzTFQ+c5KB47TLRUXUAJ35aH5H1EpaRAH7PvBLHwX8yZCFLD28MrYiA+E0ukKbDBdjTYLFX8AGjFKsw6SDBR8xNpKeHi3uBCw3YDKo4mbtiyCK0r8tAguBg2BHbtrwBUaBgTWCGEK/rl8/pNB0qivHlk/A4ubLBGmMJV2nZ+96YA2sbaWCDGDdftRSnmbLgMxKvwInENq7TCJHBCCrcyD/ZWBizRC9VZXATsM5NZllHHq8EpHpzAtR7+ATLoCW7WtNOyVCaOKSmlM3CnAfXClOLGFR6/GW9zAU1vn6ILHCQsddXAgWDijVR4J05D+SZrsk9MEyDrIaM1PBR1BX83V9AiBgtvmxaFhIUXUJjsC/6ZMcB2aAszDH/etbA711YbIfLFhtyeOq4mC8CFEQ3ndAPFEAvHcVAnL+a9riBG8unl0wJFEUAPdiOaPB2yllM6fVJ1CSzvnjIArXoKN9ArBX+8ysAGSAKplWCGciCGDCagXZoBifcE2Tq6A4zhQ9jfWCNALVYmRUBIfgjYCkmAcsgv0A+nBm+EjTTatGWUaLTyNFEVRV5yQE5Ef5l06lgmDucHP4txuBIJxrxtMXAQfMJBsyqETEgt85QZDNpUGdJO+AiJXHFRxYEdAGRfbHAB5C1pG6bkCaziTeIUeGQE/2B9gQES4MDV+z5CBvR1nJtZAH7p45VsFA6GoQCWprCS2YZ6ZGcAABadk5PdDQxcqYwqBK/V2nZaY2AsMbC3SwZL8QJoBc+aC1EWHFcbYELBkBOlnQARuOEIcD/BTru221meAHiUJilv5Bc6a2ijmvChIr0yoUgB17nzLNgNBzkRVSgbRAopmurVOFCYEKwqBy6A/vsmClK5MpCckgvv8Bnl+Y/vkjJcqakrFxyA8ZOLwErDCGeIDY5rtA/6cO8rU7C9QXSzbpYBAvS+JYj2CYAsn2MDpDBxYFaxtNAvzWVWG15CSWsiS7CQCuXd6qsETCDiI2l6GXGJKqvDAssDcfgsRPWkBP+e9jSehBeAPWHYqhGXKnKIuygAcm8x2xCjAdz/eDTM7BuCAM2F6oBEkY5ThKGBQKl6dypyBJXO4yvoBCGW4cLuYiD6Vsl+NksIGLevvExVAPZPoUxu9GfLQK7LUBAyCneOZWBE/IhGd/nDHv3uao+pKCZevpXBEKC00MFoGQ7CBrGQuU1FAE2b1Kv/4Cy1ItbjX9ALr0RELYOEMc0hXu17BTfhtK8J/Atppv4idtFTd5rk5m/HIkdBacQqAE6wGZZR1ATStq3YOQB0My1CxHZHVaRiQKjIAHGzUSrFQEmpUixA1IAPlAyZgHKF6b8Id9uzDvGzNJfwMCMeoR/LOkAUWTOv6O+BrqnfFWVwANnHRz90HGbSOkAlrvAX5M0eqb3BVXvB/CTLExlN48S01ARH0cs5TMDbhEtYuCBDUg1aPxloCnzJoXLqZBPBuMZLrGBtaKjkvSiCOo+CALR4CO+pDgGBqANJwUw8YUBbDe9Dd2tHcJxaAl/GAKclH03sGELdI42dGSFzy0ku+oGAsoiBmrXZEqTFa8RqbAiv3WrJffGsidE0lDOANCljQf3yAIgTn81iBA63SrN7BeKi1EXpRzVDofTp8f2OFOCtrQaYtFCTnspxsdAkxJLcH7AA++Qmjd42J3QYBqba4Cfh0b8j9HJcGkPYbizEegasr3DMBvKEn/KyNFx14ThtOFIAG8Cxe5ZR6XAmO7OLESDt5IZShBIGnp1BVOJVqj0qFNHByVr4qliuKxLRYWxUADj2c4BanqJUmpschATAMymW5zWMAtq8R7a+NCT3yvugyuICO7/u+muBGqvLLoRuAGv9OrZhrCdzjV5zqhA1u5PUyQgDAYEpZJkHAxsWYAqTfGL5juWj5FAE8q3VVc9A/7nil0TfCf3abWilQ')`;
 
 generate_udaf_test("theta_sketch_agg_int64", {
@@ -154,3 +154,47 @@ select `$BQ_DATASET`.theta_sketch_jaccard_similarity_seed(
   (select `$BQ_DATASET`.theta_sketch_agg_string_lgk_seed_p(str, struct<int, int, float64>(10, 111, 0.999)) from unnest(["c", "d", "e"]) as str),
   111
 );
+
+# using defaults
+# expected estimates 0.2 (0, 1), 0 (0, 2) and 0.25 (1, 2)
+select `$BQ_DATASET`.theta_sketch_jaccard_matrix([
+  (select `$BQ_DATASET`.theta_sketch_agg_string(str) from unnest(["a", "b", "c"]) as str),
+  (select `$BQ_DATASET`.theta_sketch_agg_string(str) from unnest(["c", "d", "e"]) as str),
+  (select `$BQ_DATASET`.theta_sketch_agg_string(str) from unnest(["e", "f"]) as str)
+]);
+
+# using full signatures
+# expected estimates 0.2 (0, 1), 0 (0, 2) and 0.25 (1, 2)
+select `$BQ_DATASET`.theta_sketch_jaccard_matrix_seed([
+  (select `$BQ_DATASET`.theta_sketch_agg_string_lgk_seed_p(str, struct<int, int, float64>(10, 111, 0.999)) from unnest(["a", "b", "c"]) as str),
+  (select `$BQ_DATASET`.theta_sketch_agg_string_lgk_seed_p(str, struct<int, int, float64>(10, 111, 0.999)) from unnest(["c", "d", "e"]) as str),
+  (select `$BQ_DATASET`.theta_sketch_agg_string_lgk_seed_p(str, struct<int, int, float64>(10, 111, 0.999)) from unnest(["e", "f"]) as str)
+], 111);
+
+# using defaults
+# expected estimate 2
+select `$BQ_DATASET`.theta_sketch_set_expression_estimate_and_bounds(
+  'INTERSECTION(UNION(0, 1), A_NOT_B(1, 2))',
+  [
+    (select `$BQ_DATASET`.theta_sketch_agg_string(str) from unnest(["a", "b", "c"]) as str),
+    (select `$BQ_DATASET`.theta_sketch_agg_string(str) from unnest(["c", "d", "e"]) as str),
+    (select `$BQ_DATASET`.theta_sketch_agg_string(str) from unnest(["e", "f"]) as str)
+  ],
+  2
+);
+
+# using full signatures
+# expected estimate 2
+select `$BQ_DATASET`.theta_sketch_get_estimate_seed(
+  `$BQ_DATASET`.theta_sketch_set_expression_lgk_seed(
+    'INTERSECTION(UNION(0, 1), A_NOT_B(1, 2))',
+    [
+      (select `$BQ_DATASET`.theta_sketch_agg_string_lgk_seed_p(str, struct<int, int, float64>(10, 111, 0.999)) from unnest(["a", "b", "c"]) as str),
+      (select `$BQ_DATASET`.theta_sketch_agg_string_lgk_seed_p(str, struct<int, int, float64>(10, 111, 0.999)) from unnest(["c", "d", "e"]) as str),
+      (select `$BQ_DATASET`.theta_sketch_agg_string_lgk_seed_p(str, struct<int, int, float64>(10, 111, 0.999)) from unnest(["e", "f"]) as str)
+    ],
+    10,
+    111
+  ),
+  111
+);
@@ -0,0 +1,175 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#ifndef THETA_SET_EXPRESSION_HPP_
+#define THETA_SET_EXPRESSION_HPP_
+
+#include <cctype>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <theta_sketch.hpp>
+#include <theta_union.hpp>
+#include <theta_intersection.hpp>
+#include <theta_a_not_b.hpp>
+
+#include "batch_update.hpp"
+
+/**
+ * Set expression over an array of serialized theta sketches, for example
+ * INTERSECTION(UNION(0, 1), A_NOT_B(2, 3)).
+ * Operands are zero-based indexes into the array or nested operations:
+ *   UNION(x, y, ...), INTERSECTION(x, y, ...) and A_NOT_B(x, y).
+ * Operation names are case-insensitive. Operations can be nested up to MAX_DEPTH levels,
+ * which bounds the recursion of parsing and evaluation.
+ * The whole tree is evaluated in memory: input sketches are wrapped without deserialization
+ * and intermediate results are kept as compact sketches, so only the final result is serialized.
+ */
+class theta_set_expression {
+public:
+  using compact_theta_sketch = datasketches::compact_theta_sketch;
+  using wrapped_compact_theta_sketch = datasketches::wrapped_compact_theta_sketch;
+
+  static constexpr size_t MAX_DEPTH = 64;
+
+  /**
+   * Parses the expression.
+   * @param expression expression to parse
+   * @param num_sketches number of sketches the expression will be evaluated over
+   * @throw std::invalid_argument if the expression is malformed, nested too deeply or refers to a sketch out of range
+   */
+  theta_set_expression(const std::string& expression, size_t num_sketches): expression_(expression), pos_(0) {
+    root_ = parse_node(num_sketches, 0);
+    skip_spaces();
+    if (pos_ != expression_.size()) throw_error("unexpected trailing characters");
+  }
+
+  /**
+   * Evaluates the expression.
+   * @param sketches packed serialized compact theta sketches referred to by the expression
+   * @param lg_k log2 of nominal entries used by unions
+   * @param seed seed the sketches were built with
+   * @return result as a compact sketch
+   */
+  compact_theta_sketch evaluate(const packed_items& sketches, uint8_t lg_k, uint64_t seed) const {
+    std::vector<wrapped_compact_theta_sketch> wrapped;
+    wrapped.reserve(sketches.size());
+    for (size_t i = 0; i < sketches.size(); ++i) {
+      wrapped.push_back(wrapped_compact_theta_sketch::wrap(sketches.item_data(i), sketches.item_size(i), seed));
+    }
+    if (root_.op == SKETCH) return compact_theta_sketch(wrapped[root_.index], true);
+    return evaluate_node(root_, wrapped, lg_k, seed);
+  }
+
+private:
+  enum op_type { SKETCH, UNION, INTERSECTION, A_NOT_B };
+
+  struct node {
+    op_type op;
+    size_t index;
+    std::vector<node> operands;
+  };
+
+  std::string expression_;
+  size_t pos_;
+  node root_;
+
+  // applies func to the operand: a wrapped input sketch or an evaluated nested operation
+  template<typename Func>
+  static decltype(auto) with_operand(const node& n, const std::vector<wrapped_compact_theta_sketch>& sketches,
+      uint8_t lg_k, uint64_t seed, Func&& func) {
+    if (n.op == SKETCH) return func(sketches[n.index]);
+    return func(evaluate_node(n, sketches, lg_k, seed));
+  }
+
+  static compact_theta_sketch evaluate_node(const node& n, const std::vector<wrapped_compact_theta_sketch>& sketches,
+      uint8_t lg_k, uint64_t seed) {
+    if (n.op == UNION) {
+      auto u = datasketches::theta_union::builder().set_lg_k(lg_k).set_seed(seed).build();
+      for (const auto& operand: n.operands) {
+        with_operand(operand, sketches, lg_k, seed, [&u](const auto& sketch) { u.update(sketch); });
+      }
+      return u.get_result();
+    }
+    if (n.op == INTERSECTION) {
+      datasketches::theta_intersection intersection(seed);
+      for (const auto& operand: n.operands) {
+        with_operand(operand, sketches, lg_k, seed, [&intersection](const auto& sketch) { intersection.update(sketch); });
+      }
+      return intersection.get_result();
+    }
+    const datasketches::theta_a_not_b a_not_b(seed);
+    return with_operand(n.operands[0], sketches, lg_k, seed, [&](const auto& a) {
+      return with_operand(n.operands[1], sketches, lg_k, seed, [&](const auto& b) { return a_not_b.compute(a, b); });
+    });
+  }
+
+  node parse_node(size_t num_sketches, size_t depth) {
+    skip_spaces();
+    if (pos_ == expression_.size()) throw_error("operand expected");
+    if (std::isdigit(static_cast<unsigned char>(expression_[pos_]))) {
+      size_t index = 0;
+      while (pos_ < expression_.size() && std::isdigit(static_cast<unsigned char>(expression_[pos_]))) {
+        index = index * 10 + (expression_[pos_++] - '0');
+        if (index >= num_sketches) throw_error("sketch index out of range, number of sketches " + std::to_string(num_sketches));
+      }
+      return node{SKETCH, index, {}};
+    }
+    std::string name;
+    while (pos_ < expression_.size() && (std::isalpha(static_cast<unsigned char>(expression_[pos_])) || expression_[pos_] == '_')) {
+      name.push_back(std::toupper(static_cast<unsigned char>(expression_[pos_++])));
+    }
+    node n{SKETCH, 0, {}};
+    if (name == "UNION") n.op = UNION;
+    else if (name == "INTERSECTION") n.op = INTERSECTION;
+    else if (name == "A_NOT_B") n.op = A_NOT_B;
+    else throw_error("sketch index or one of UNION, INTERSECTION, A_NOT_B expected");
+    if (depth == MAX_DEPTH) throw_error("operations nested deeper than " + std::to_string(MAX_DEPTH) + " levels");
+    expect('(');
+    n.operands.push_back(parse_node(num_sketches, depth + 1));
+    skip_spaces();
+    while (pos_ < expression_.size() && expression_[pos_] == ',') {
+      ++pos_;
+      n.operands.push_back(parse_node(num_sketches, depth + 1));
+      skip_spaces();
+    }
+    expect(')');
+    if (n.op == A_NOT_B && n.operands.size() != 2) throw_error("A_NOT_B requires exactly 2 operands");
+    return n;
+  }
+
+  void expect(char c) {
+    skip_spaces();
+    if (pos_ == expression_.size() || expression_[pos_] != c) throw_error(std::string("'") + c + "' expected");
+    ++pos_;
+  }
+
+  void skip_spaces() {
+    while (pos_ < expression_.size() && std::isspace(static_cast<unsigned char>(expression_[pos_]))) ++pos_;
+  }
+
+  [[noreturn]] void throw_error(const std::string& message) const {
+    throw std::invalid_argument("set expression error at position " + std::to_string(pos_) + ": " + message);
+  }
+};
+
+#endif
@@ -17,24 +17,39 @@
  * under the License.
  */
 
-#include <strstream>
 #include <emscripten/bind.h>
+#include <emscripten/emscripten.h>
 
 #include <theta_sketch.hpp>
 #include <theta_union.hpp>
-#include <theta_intersection.hpp>
-#include <theta_a_not_b.hpp>
 #include <theta_jaccard_similarity.hpp>
 
-using datasketches::update_theta_sketch;
+#include "batch_update.hpp"
+#include "batch_update_theta_sketch.hpp"
+#include "handle_table.hpp"
+#include "heap_stats.hpp"
+#include "jaccard_matrix.hpp"
+#include "op_stats.hpp"
+#include "serialize_into.hpp"
+#include "theta_set_expression.hpp"
+#include "theta_sorted_set_operations.hpp"
+
+#ifdef USE_ARENA_ALLOCATOR
+using update_theta_sketch = batch_update_theta_sketch_alloc<arena_allocator<uint64_t>>;
+using theta_union = datasketches::theta_union_alloc<arena_allocator<uint64_t>>;
+#else
+using update_theta_sketch = batch_update_theta_sketch;
+using datasketches::theta_union;
+#endif
 using datasketches::compact_theta_sketch;
 using datasketches::wrapped_compact_theta_sketch;
-using datasketches::theta_union;
-using datasketches::theta_intersection;
-using datasketches::theta_a_not_b;
 
 const emscripten::val Uint8Array = emscripten::val::global("Uint8Array");
+const emscripten::val Float64Array = emscripten::val::global("Float64Array");
 
+// Building with -DQUERY_ONLY=1 (theta_sketch_query.js) leaves out everything but the read-only
+// functions of compact_theta_sketch used by the scalar UDFs, so the linker can drop
+// the update, union and set operation code and the module is smaller and faster to instantiate.
 EMSCRIPTEN_BINDINGS(theta_sketch) {
   emscripten::register_vector<double>("VectorDouble");
 
@@ -42,67 +57,129 @@ EMSCRIPTEN_BINDINGS(theta_sketch) {
     return std::string(reinterpret_cast<std::exception*>(ptr)->what());
   }));
 
+  emscripten::function("getHeapStats", &get_heap_stats);
+  emscripten::function("getStats", &get_op_stats);
+  emscripten::function("resetStats", &reset_op_stats);
+
   emscripten::constant("DEFAULT_LG_K", datasketches::theta_constants::DEFAULT_LG_K);
   emscripten::constant("DEFAULT_SEED", datasketches::DEFAULT_SEED);
 
+#ifndef QUERY_ONLY
   emscripten::class_<update_theta_sketch>("update_theta_sketch")
     .constructor(emscripten::optional_override([](uint8_t lg_k, uint64_t seed, float p) {
-      return new update_theta_sketch(update_theta_sketch::builder().set_lg_k(lg_k).set_seed(seed).set_p(p).build());
+      return new update_theta_sketch(lg_k, seed, p);
+    }))
+    .function("updateString", emscripten::optional_override([](update_theta_sketch& self, const std::string& value) {
+      OP_STATS_TIMED(UPDATE);
+      OP_STATS_COUNT(ITEMS, 1);
+      self.update(value);
+    }))
+    .function("updateInt64", emscripten::optional_override([](update_theta_sketch& self, uint64_t value) {
+      OP_STATS_TIMED(UPDATE);
+      OP_STATS_COUNT(ITEMS, 1);
+      self.update(value);
+    }))
+    .function("updateStringBatch", emscripten::optional_override([](update_theta_sketch& self, intptr_t offsets, intptr_t bytes, size_t count) {
+      OP_STATS_TIMED(UPDATE);
+      OP_STATS_COUNT(ITEMS, count);
+      self.update_batch(packed_items(offsets, bytes, count));
+    }))
+    .function("updateInt64Batch", emscripten::optional_override([](update_theta_sketch& self, intptr_t values, size_t count) {
+      OP_STATS_TIMED(UPDATE);
+      OP_STATS_COUNT(ITEMS, count);
+      self.update_batch(reinterpret_cast<const uint64_t*>(values), count);
     }))
-    .function("updateString", emscripten::select_overload<void(const std::string&)>(&update_theta_sketch::update))
-    .function("updateInt64", emscripten::select_overload<void(uint64_t)>(&update_theta_sketch::update))
     .function("serializeAsUint8ArrayCompressed", emscripten::optional_override([](const update_theta_sketch& self) {
+      OP_STATS_TIMED(SERIALIZE);
       auto bytes = self.compact().serialize_compressed();
+      OP_STATS_COUNT(SERIALIZED_BYTES, bytes.size());
       return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
     }))
+    .function("serializeIntoCompressed", emscripten::optional_override([](const update_theta_sketch& self, intptr_t bytes, size_t capacity) {
+      const auto sketch = self.compact();
+      return serialize_into(bytes, capacity, [&sketch](std::ostream& os) { sketch.serialize_compressed(os); });
+    }))
     ;
+#endif
 
   emscripten::class_<compact_theta_sketch>("compact_theta_sketch")
     .class_function("getEstimateFromBytes", emscripten::optional_override([](const std::string& bytes, uint64_t seed) {
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
       return wrapped_compact_theta_sketch::wrap(bytes.data(), bytes.size(), seed).get_estimate();
     }))
     .class_function("getEstimateAndBoundsFromBytes", emscripten::optional_override([](const std::string& bytes, uint8_t num_std_devs, uint64_t seed) {
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
       const auto sketch =  wrapped_compact_theta_sketch::wrap(bytes.data(), bytes.size(), seed);
       return std::vector<double>{sketch.get_estimate(), sketch.get_lower_bound(num_std_devs), sketch.get_upper_bound(num_std_devs)};
     }))
     .class_function("toStringFromBytes", emscripten::optional_override([](const std::string& bytes, uint64_t seed) {
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
       return wrapped_compact_theta_sketch::wrap(bytes.data(), bytes.size(), seed).to_string();
     }))
     .class_function("getThetaFromBytes", emscripten::optional_override([](const std::string& bytes, uint64_t seed) {
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
       return wrapped_compact_theta_sketch::wrap(bytes.data(), bytes.size(), seed).get_theta();
     }))
     .class_function("getNumRetainedFromBytes", emscripten::optional_override([](const std::string& bytes, uint64_t seed) {
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
       return wrapped_compact_theta_sketch::wrap(bytes.data(), bytes.size(), seed).get_num_retained();
     }))
     .class_function("getMaxSerializedSizeBytes", &compact_theta_sketch::get_max_serialized_size_bytes)
     ;
 
+#ifndef QUERY_ONLY
   emscripten::class_<theta_union>("theta_union")
     .constructor(emscripten::optional_override([](uint8_t lg_k, uint64_t seed) {
       return new theta_union(theta_union::builder().set_lg_k(lg_k).set_seed(seed).build());
     }))
     .function("updateWithUpdateSketch", emscripten::optional_override([](theta_union& self, const update_theta_sketch& sketch) {
+      OP_STATS_TIMED(MERGE);
+      OP_STATS_COUNT(MERGED_SKETCHES, 1);
       self.update(sketch);
     }))
     .function("updateWithCompactSketch", emscripten::optional_override([](theta_union& self, const compact_theta_sketch& sketch) {
+      OP_STATS_TIMED(MERGE);
+      OP_STATS_COUNT(MERGED_SKETCHES, 1);
       self.update(sketch);
     }))
     .function("updateWithBytes", emscripten::optional_override([](theta_union& self, const std::string& bytes, uint64_t seed) {
+      OP_STATS_TIMED(MERGE);
+      OP_STATS_COUNT(MERGED_SKETCHES, 1);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
       self.update(wrapped_compact_theta_sketch::wrap(bytes.data(), bytes.size(), seed));
     }))
     .function("updateWithBuffer", emscripten::optional_override([](theta_union& self, intptr_t bytes, size_t size, uint64_t seed) {
+      OP_STATS_TIMED(MERGE);
+      OP_STATS_COUNT(MERGED_SKETCHES, 1);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, size);
       self.update(wrapped_compact_theta_sketch::wrap(reinterpret_cast<void*>(bytes), size, seed));
     }))
+    .function("updateWithPacked", emscripten::optional_override([](theta_union& self, intptr_t offsets, intptr_t bytes, size_t count, uint64_t seed) {
+      OP_STATS_TIMED(MERGE);
+      OP_STATS_COUNT(MERGED_SKETCHES, count);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, packed_items(offsets, bytes, count).total_size());
+      update_union_packed(self, packed_items(offsets, bytes, count), [seed](const char* data, size_t size) {
+        return wrapped_compact_theta_sketch::wrap(data, size, seed);
+      });
+    }))
     .function("getResultStreamCompressed", emscripten::optional_override([](theta_union& self, intptr_t bytes, size_t size) {
-      std::strstream stream(reinterpret_cast<char*>(bytes), size);
-      self.get_result().serialize_compressed(stream);
-      return (int) stream.tellp();
+      const auto sketch = self.get_result();
+      return (int) serialize_into(bytes, size, [&sketch](std::ostream& os) { sketch.serialize_compressed(os); });
     }))
     .function("getResultAsUint8ArrayCompressed", emscripten::optional_override([](theta_union& self) {
+      OP_STATS_TIMED(SERIALIZE);
       auto bytes = self.get_result().serialize_compressed();
+      OP_STATS_COUNT(SERIALIZED_BYTES, bytes.size());
       return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
     }))
     .class_function("computeWithBytesReturnCompressed", emscripten::optional_override([](const std::string& bytes1, const std::string& bytes2, uint8_t lg_k, uint64_t seed) {
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes1.size() + bytes2.size());
       auto u = theta_union::builder().set_lg_k(lg_k).set_seed(seed).build();
       u.update(wrapped_compact_theta_sketch::wrap(bytes1.data(), bytes1.size(), seed));
       u.update(wrapped_compact_theta_sketch::wrap(bytes2.data(), bytes2.size(), seed));
@@ -112,24 +189,26 @@ EMSCRIPTEN_BINDINGS(theta_sketch) {
     ;
 
   emscripten::function("thetaIntersectionCompressed", emscripten::optional_override([](const std::string& bytes1, const std::string& bytes2, uint64_t seed) {
-      theta_intersection intersection(seed);
-      intersection.update(wrapped_compact_theta_sketch::wrap(bytes1.data(), bytes1.size(), seed));
-      intersection.update(wrapped_compact_theta_sketch::wrap(bytes2.data(), bytes2.size(), seed));
-      const auto bytes = intersection.get_result().serialize_compressed();
-      return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
-    }))
-    ;
+    OP_STATS_TIMED(QUERY);
+    OP_STATS_COUNT(DESERIALIZED_BYTES, bytes1.size() + bytes2.size());
+    const auto bytes = theta_sorted_set_operations::intersection(
+      bytes1.data(), bytes1.size(), bytes2.data(), bytes2.size(), seed
+    ).serialize_compressed();
+    return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
+  }));
 
   emscripten::function("thetaAnotBCompressed", emscripten::optional_override([](const std::string& bytes1, const std::string& bytes2, uint64_t seed) {
-      const auto bytes = theta_a_not_b(seed).compute(
-        wrapped_compact_theta_sketch::wrap(bytes1.data(), bytes1.size(), seed),
-        wrapped_compact_theta_sketch::wrap(bytes2.data(), bytes2.size(), seed)
-      ).serialize_compressed();
-      return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
-    }))
-    ;
+    OP_STATS_TIMED(QUERY);
+    OP_STATS_COUNT(DESERIALIZED_BYTES, bytes1.size() + bytes2.size());
+    const auto bytes = theta_sorted_set_operations::a_not_b(
+      bytes1.data(), bytes1.size(), bytes2.data(), bytes2.size(), seed
+    ).serialize_compressed();
+    return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
+  }));
 
   emscripten::function("thetaJaccardSimilarity", emscripten::optional_override([](const std::string& bytes1, const std::string& bytes2, uint64_t seed) {
+    OP_STATS_TIMED(QUERY);
+    OP_STATS_COUNT(DESERIALIZED_BYTES, bytes1.size() + bytes2.size());
     const auto arr = datasketches::theta_jaccard_similarity::jaccard(
       wrapped_compact_theta_sketch::wrap(bytes1.data(), bytes1.size(), seed),
       wrapped_compact_theta_sketch::wrap(bytes2.data(), bytes2.size(), seed),
@@ -137,4 +216,108 @@ EMSCRIPTEN_BINDINGS(theta_sketch) {
     );
     return std::vector<double>{arr[0], arr[1], arr[2]};
   }));
+
+  // upper triangle of the matrix as a flat array: lower bound, estimate and upper bound
+  // for every pair (i, j) with i < j in row-major order
+  emscripten::function("thetaJaccardMatrix", emscripten::optional_override([](intptr_t offsets, intptr_t bytes, size_t count, uint64_t seed) {
+    OP_STATS_TIMED(QUERY);
+    const packed_items items(offsets, bytes, count);
+    OP_STATS_COUNT(DESERIALIZED_BYTES, items.total_size());
+    std::vector<wrapped_compact_theta_sketch> sketches;
+    sketches.reserve(items.size());
+    for (size_t i = 0; i < items.size(); ++i) {
+      sketches.push_back(wrapped_compact_theta_sketch::wrap(items.item_data(i), items.item_size(i), seed));
+    }
+    const jaccard_matrix<wrapped_compact_theta_sketch, datasketches::theta_jaccard_similarity> matrix(sketches, seed);
+    std::vector<double> values(matrix.get_num_values());
+    matrix.compute(values.data());
+    return Float64Array.new_(emscripten::typed_memory_view(values.size(), values.data()));
+  }));
+
+  emscripten::function("thetaSetExpressionCompressed", emscripten::optional_override([](
+    const std::string& expression, intptr_t offsets, intptr_t bytes, size_t count, uint8_t lg_k, uint64_t seed
+  ) {
+    OP_STATS_TIMED(QUERY);
+    const packed_items sketches(offsets, bytes, count);
+    OP_STATS_COUNT(DESERIALIZED_BYTES, sketches.total_size());
+    const auto result = theta_set_expression(expression, count).evaluate(sketches, lg_k, seed).serialize_compressed();
+    return Uint8Array.new_(emscripten::typed_memory_view(result.size(), result.data()));
+  }));
+
+  emscripten::function("thetaSetExpressionEstimateAndBounds", emscripten::optional_override([](
+    const std::string& expression, intptr_t offsets, intptr_t bytes, size_t count, uint8_t num_std_devs, uint8_t lg_k, uint64_t seed
+  ) {
+    OP_STATS_TIMED(QUERY);
+    const packed_items sketches(offsets, bytes, count);
+    OP_STATS_COUNT(DESERIALIZED_BYTES, sketches.total_size());
+    const auto sketch = theta_set_expression(expression, count).evaluate(sketches, lg_k, seed);
+    return std::vector<double>{sketch.get_estimate(), sketch.get_lower_bound(num_std_devs), sketch.get_upper_bound(num_std_devs)};
+  }));
+#endif
+}
+
+// Plain C entry points for the hottest operations, called as Module._theta_*.
+// Sketches and unions are referred to by handles and bytes are passed as heap pointers,
+// so there is no embind conversion of arguments or results.
+#ifndef QUERY_ONLY
+handle_table<update_theta_sketch> sketches;
+handle_table<theta_union> unions;
+#endif
+
+extern "C" {
+
+#ifndef QUERY_ONLY
+EMSCRIPTEN_KEEPALIVE uint32_t theta_sketch_create(uint8_t lg_k, uint64_t seed, float p) {
+  return sketches.create(lg_k, seed, p);
+}
+
+EMSCRIPTEN_KEEPALIVE void theta_sketch_destroy(uint32_t handle) {
+  sketches.destroy(handle);
+}
+
+EMSCRIPTEN_KEEPALIVE void theta_sketch_update_int64(uint32_t handle, uint64_t value) {
+  OP_STATS_TIMED(UPDATE);
+  OP_STATS_COUNT(ITEMS, 1);
+  sketches.get(handle).update(value);
+}
+
+EMSCRIPTEN_KEEPALIVE void theta_sketch_update_string(uint32_t handle, const char* data, size_t size) {
+  OP_STATS_TIMED(UPDATE);
+  OP_STATS_COUNT(ITEMS, 1);
+  sketches.get(handle).update(data, size);
+}
+
+// compressed like serializeAsUint8ArrayCompressed, returns the number of bytes written
+EMSCRIPTEN_KEEPALIVE size_t theta_sketch_serialize_into(uint32_t handle, intptr_t bytes, size_t capacity) {
+  const auto sketch = sketches.get(handle).compact();
+  return serialize_into(bytes, capacity, [&sketch](std::ostream& os) { sketch.serialize_compressed(os); });
+}
+
+EMSCRIPTEN_KEEPALIVE uint32_t theta_union_create(uint8_t lg_k, uint64_t seed) {
+  return unions.create(theta_union::builder().set_lg_k(lg_k).set_seed(seed).build());
+}
+
+EMSCRIPTEN_KEEPALIVE void theta_union_destroy(uint32_t handle) {
+  unions.destroy(handle);
+}
+
+EMSCRIPTEN_KEEPALIVE void theta_union_update(uint32_t handle, const void* bytes, size_t size, uint64_t seed) {
+  OP_STATS_TIMED(MERGE);
+  OP_STATS_COUNT(MERGED_SKETCHES, 1);
+  OP_STATS_COUNT(DESERIALIZED_BYTES, size);
+  unions.get(handle).update(wrapped_compact_theta_sketch::wrap(bytes, size, seed));
+}
+
+EMSCRIPTEN_KEEPALIVE size_t theta_union_get_result_into(uint32_t handle, intptr_t bytes, size_t capacity) {
+  const auto sketch = unions.get(handle).get_result();
+  return serialize_into(bytes, capacity, [&sketch](std::ostream& os) { sketch.serialize_compressed(os); });
+}
+#endif
+
+EMSCRIPTEN_KEEPALIVE double theta_get_estimate(const void* bytes, size_t size, uint64_t seed) {
+  OP_STATS_TIMED(QUERY);
+  OP_STATS_COUNT(DESERIALIZED_BYTES, size);
+  return wrapped_compact_theta_sketch::wrap(bytes, size, seed).get_estimate();
+}
+
 }
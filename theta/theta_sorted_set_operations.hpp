@@ -0,0 +1,265 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef THETA_SORTED_SET_OPERATIONS_HPP_
+#define THETA_SORTED_SET_OPERATIONS_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#ifdef __wasm_simd128__
+#include <wasm_simd128.h>
+#endif
+
+#include <theta_sketch.hpp>
+
+#include "murmur_hash_batch.hpp"
+
+/**
+ * Intersection and A-not-B of two serialized compact theta sketches as merge-joins of sorted hash arrays.
+ * The generic theta_intersection inserts every entry of the first sketch into a hash table,
+ * which costs O(n) inserts even if the other sketch is tiny. Here the hashes below theta are read
+ * in place from ordered sketches in the standard format, and the arrays are joined:
+ * with galloping (exponential) search in the larger array when the sizes differ a lot,
+ * and otherwise with a block merge, vectorized in SIMD builds.
+ * Compressed and legacy sketches are decoded through the wrapped sketch iterator, and decoding stops
+ * as soon as the remaining entries cannot be in the result. Unordered sketches are decoded and sorted.
+ * The results are the same as from theta_intersection and theta_a_not_b, including the empty flag and theta.
+ */
+namespace theta_sorted_set_operations {
+
+using datasketches::compact_theta_sketch;
+using datasketches::wrapped_compact_theta_sketch;
+
+// larger array size over smaller array size from which galloping search is used
+constexpr size_t GALLOP_RATIO = 32;
+
+/**
+ * Sorted hashes of a wrapped sketch below a limit, either in place or decoded into a buffer.
+ */
+class sorted_hashes {
+public:
+  /**
+   * @param sketch wrapped sketch
+   * @param bytes serialized sketch the wrapped sketch was created from
+   * @param limit only hashes below this value are needed
+   */
+  sorted_hashes(const wrapped_compact_theta_sketch& sketch, const void* bytes, uint64_t limit): data_(nullptr), size_(0) {
+    const uint8_t* ptr = static_cast<const uint8_t*>(bytes);
+    const uint8_t preamble_longs = ptr[0];
+    const uint8_t serial_version = ptr[1];
+    // entries of the standard format start right after the preamble
+    const uint8_t* entries = ptr + preamble_longs * sizeof(uint64_t);
+    if (sketch.is_ordered() && serial_version == 3 && reinterpret_cast<uintptr_t>(entries) % alignof(uint64_t) == 0) {
+      data_ = reinterpret_cast<const uint64_t*>(entries);
+      size_ = std::lower_bound(data_, data_ + sketch.get_num_retained(), limit) - data_;
+      return;
+    }
+    buffer_.reserve(sketch.get_num_retained());
+    for (const uint64_t hash: sketch) {
+      if (hash < limit) buffer_.push_back(hash);
+      else if (sketch.is_ordered()) break;
+    }
+    if (!sketch.is_ordered()) std::sort(buffer_.begin(), buffer_.end());
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+  }
+
+  sorted_hashes(const sorted_hashes&) = delete;
+  sorted_hashes& operator=(const sorted_hashes&) = delete;
+
+  const uint64_t* data() const { return data_; }
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  uint64_t back() const { return data_[size_ - 1]; }
+
+private:
+  const uint64_t* data_;
+  size_t size_;
+  std::vector<uint64_t> buffer_;
+};
+
+// index of the first element not less than value, searching from pos with exponentially growing steps
+inline size_t gallop(const uint64_t* data, size_t pos, size_t size, uint64_t value) {
+  size_t step = 1;
+  size_t hi = pos;
+  while (hi < size && data[hi] < value) {
+    pos = hi + 1;
+    hi += step;
+    step <<= 1;
+  }
+  return std::lower_bound(data + pos, data + std::min(hi, size), value) - data;
+}
+
+// hashes of small found in large, large is much larger
+inline void intersect_gallop(const uint64_t* small, size_t small_size, const uint64_t* large, size_t large_size,
+    std::vector<uint64_t>& result) {
+  size_t j = 0;
+  for (size_t i = 0; i < small_size; ++i) {
+    j = gallop(large, j, large_size, small[i]);
+    if (j == large_size) return;
+    if (large[j] == small[i]) result.push_back(small[i]);
+  }
+}
+
+inline void intersect_merge(const uint64_t* a, size_t a_size, const uint64_t* b, size_t b_size,
+    std::vector<uint64_t>& result) {
+  size_t i = 0;
+  size_t j = 0;
+#ifdef __wasm_simd128__
+  // blocks of 4 are compared all against all, then the block with the smaller last hash is skipped
+  // (both if equal), since none of its hashes can match a later hash of the other array
+  while (i + 4 <= a_size && j + 4 <= b_size) {
+    const v128_t a01 = wasm_v128_load(a + i);
+    const v128_t a23 = wasm_v128_load(a + i + 2);
+    v128_t eq01 = wasm_i64x2_eq(a01, wasm_i64x2_splat(b[j]));
+    v128_t eq23 = wasm_i64x2_eq(a23, wasm_i64x2_splat(b[j]));
+    for (size_t k = 1; k < 4; ++k) {
+      const v128_t bk = wasm_i64x2_splat(b[j + k]);
+      eq01 = wasm_v128_or(eq01, wasm_i64x2_eq(a01, bk));
+      eq23 = wasm_v128_or(eq23, wasm_i64x2_eq(a23, bk));
+    }
+    const uint32_t mask = wasm_i64x2_bitmask(eq01) | (wasm_i64x2_bitmask(eq23) << 2);
+    for (size_t k = 0; k < 4; ++k) {
+      if (mask & (1 << k)) result.push_back(a[i + k]);
+    }
+    const uint64_t a_last = a[i + 3];
+    const uint64_t b_last = b[j + 3];
+    if (a_last <= b_last) i += 4;
+    if (b_last <= a_last) j += 4;
+  }
+#endif
+  while (i < a_size && j < b_size) {
+    if (a[i] < b[j]) {
+      ++i;
+    } else if (b[j] < a[i]) {
+      ++j;
+    } else {
+      result.push_back(a[i]);
+      ++i;
+      ++j;
+    }
+  }
+}
+
+inline void intersect(const uint64_t* a, size_t a_size, const uint64_t* b, size_t b_size, std::vector<uint64_t>& result) {
+  if (a_size > b_size) return intersect(b, b_size, a, a_size, result);
+  if (b_size >= a_size * GALLOP_RATIO) {
+    intersect_gallop(a, a_size, b, b_size, result);
+  } else {
+    intersect_merge(a, a_size, b, b_size, result);
+  }
+}
+
+// hashes of a not found in b
+inline void difference(const uint64_t* a, size_t a_size, const uint64_t* b, size_t b_size, std::vector<uint64_t>& result) {
+  if (b_size >= a_size * GALLOP_RATIO) {
+    // few hashes of a looked up in b
+    size_t j = 0;
+    for (size_t i = 0; i < a_size; ++i) {
+      j = gallop(b, j, b_size, a[i]);
+      if (j == b_size || b[j] != a[i]) result.push_back(a[i]);
+    }
+  } else if (a_size >= b_size * GALLOP_RATIO) {
+    // runs of a between the few hashes of b are copied
+    size_t i = 0;
+    for (size_t j = 0; j < b_size && i < a_size; ++j) {
+      const size_t end = gallop(a, i, a_size, b[j]);
+      result.insert(result.end(), a + i, a + end);
+      i = end < a_size && a[end] == b[j] ? end + 1 : end;
+    }
+    result.insert(result.end(), a + i, a + a_size);
+  } else {
+    std::set_difference(a, a + a_size, b, b + b_size, std::back_inserter(result));
+  }
+}
+
+inline uint16_t seed_hash(uint64_t seed) {
+  // same as compute_seed_hash(seed)
+  return static_cast<uint16_t>(murmur_hash_batch::hash_int64_h1(seed, 0));
+}
+
+/**
+ * Intersection of two serialized compact theta sketches, same as theta_intersection updated with both.
+ * @param bytes_a first serialized sketch
+ * @param size_a size of the first sketch in bytes
+ * @param bytes_b second serialized sketch
+ * @param size_b size of the second sketch in bytes
+ * @param seed seed the sketches were built with
+ * @return ordered compact sketch
+ */
+inline compact_theta_sketch intersection(const void* bytes_a, size_t size_a, const void* bytes_b, size_t size_b, uint64_t seed) {
+  const auto a = wrapped_compact_theta_sketch::wrap(bytes_a, size_a, seed);
+  const auto b = wrapped_compact_theta_sketch::wrap(bytes_b, size_b, seed);
+  if (a.is_empty() || b.is_empty()) {
+    return compact_theta_sketch(true, true, seed_hash(seed), datasketches::theta_constants::MAX_THETA, {});
+  }
+  const uint64_t theta = std::min(a.get_theta64(), b.get_theta64());
+  std::vector<uint64_t> entries;
+  if (a.get_num_retained() > 0 && b.get_num_retained() > 0) {
+    // the smaller sketch is read first, the larger one only up to the last hash of the smaller one
+    const bool a_first = a.get_num_retained() <= b.get_num_retained();
+    const sorted_hashes first(a_first ? a : b, a_first ? bytes_a : bytes_b, theta);
+    if (!first.empty()) {
+      const sorted_hashes second(a_first ? b : a, a_first ? bytes_b : bytes_a, std::min(theta, first.back() + 1));
+      entries.reserve(std::min(first.size(), second.size()));
+      intersect(first.data(), first.size(), second.data(), second.size(), entries);
+    }
+    if (entries.empty() && theta == datasketches::theta_constants::MAX_THETA) {
+      return compact_theta_sketch(true, true, seed_hash(seed), theta, {});
+    }
+  }
+  return compact_theta_sketch(false, true, seed_hash(seed), theta, std::move(entries));
+}
+
+/**
+ * Set difference of two serialized compact theta sketches, same as theta_a_not_b::compute(a, b).
+ * @param bytes_a serialized sketch A
+ * @param size_a size of sketch A in bytes
+ * @param bytes_b serialized sketch B
+ * @param size_b size of sketch B in bytes
+ * @param seed seed the sketches were built with
+ * @return ordered compact sketch
+ */
+inline compact_theta_sketch a_not_b(const void* bytes_a, size_t size_a, const void* bytes_b, size_t size_b, uint64_t seed) {
+  const auto a = wrapped_compact_theta_sketch::wrap(bytes_a, size_a, seed);
+  const auto b = wrapped_compact_theta_sketch::wrap(bytes_b, size_b, seed);
+  // as in theta_a_not_b, A without entries but in estimation mode still gets the smaller theta of B
+  if (a.is_empty() || (a.get_num_retained() > 0 && b.is_empty())) return compact_theta_sketch(a, true);
+  const uint64_t theta = std::min(a.get_theta64(), b.get_theta64());
+  const sorted_hashes hashes_a(a, bytes_a, theta);
+  std::vector<uint64_t> entries;
+  entries.reserve(hashes_a.size());
+  if (hashes_a.empty() || b.get_num_retained() == 0) {
+    entries.assign(hashes_a.data(), hashes_a.data() + hashes_a.size());
+  } else {
+    // hashes of B above the last hash of A do not matter
+    const sorted_hashes hashes_b(b, bytes_b, std::min(theta, hashes_a.back() + 1));
+    difference(hashes_a.data(), hashes_a.size(), hashes_b.data(), hashes_b.size(), entries);
+  }
+  const bool is_empty = entries.empty() && theta == datasketches::theta_constants::MAX_THETA;
+  return compact_theta_sketch(is_empty, true, seed_hash(seed), theta, std::move(entries));
+}
+
+} /* namespace theta_sorted_set_operations */
+
+#endif
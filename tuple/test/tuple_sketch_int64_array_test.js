@@ -0,0 +1,87 @@
+
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+const { generate_udf_test, generate_udaf_test } = unit_test_utils;
+
+// using defaults
+
+generate_udaf_test("tuple_sketch_int64_array_agg_string", {
+  input_columns: [`str`, `[1, 10]`],
+  input_rows: `SELECT * FROM UNNEST([CAST(NULL AS STRING), CAST(NULL AS STRING), CAST(NULL AS STRING)]) AS str`,
+  expected_output: null
+});
+
+generate_udaf_test("tuple_sketch_int64_array_agg_int64", {
+  input_columns: [`value`, `[1, 10]`],
+  input_rows: `SELECT * FROM UNNEST([NULL, NULL, NULL]) AS value`,
+  expected_output: null
+});
+
+generate_udaf_test("tuple_sketch_int64_array_agg_union", {
+  input_columns: [`sketch`],
+  input_rows: `SELECT * FROM UNNEST([CAST(NULL AS BYTES), CAST(NULL AS BYTES), CAST(NULL AS BYTES)]) AS sketch`,
+  expected_output: null
+});
+
+const tuple_array_1 = `FROM_BASE64('AQEJgxgCzJP/////////fwMAAAAAAAAAtwxu5aivQAiFf0C2icflNBfBHVKFBwF7AwAAAAAAAAAeAAAAAAAAAAIAAAAAAAAAFAAAAAAAAAABAAAAAAAAAAoAAAAAAAAA')`;
+
+generate_udaf_test("tuple_sketch_int64_array_agg_string", {
+  input_columns: [`str`, `vals`],
+  input_rows: `SELECT * FROM UNNEST([STRUCT('a' AS str, [1, 10] AS vals), ('b', [2, 20]), ('c', [3, 30])])`,
+  expected_output: tuple_array_1
+});
+
+const tuple_array_2 = `FROM_BASE64('AQEJgxgCzJP/////////fwMAAAAAAAAAtwxu5aivQAhOPehbCCvBLuBfNe11HQBzBQAAAAAAAAAyAAAAAAAAAAYAAAAAAAAAPAAAAAAAAAAEAAAAAAAAACgAAAAAAAAA')`;
+
+generate_udaf_test("tuple_sketch_int64_array_agg_string", {
+  input_columns: [`str`, `vals`],
+  input_rows: `SELECT * FROM UNNEST([STRUCT('c' AS str, [2, 20] AS vals), ('d', [4, 40]), ('c', [3, 30]), ('e', [6, 60])])`,
+  expected_output: tuple_array_2
+});
+
+generate_udaf_test("tuple_sketch_int64_array_agg_string_lgk_seed_p_modes", {
+  input_columns: [`str`, `vals`, `STRUCT(CAST(NULL AS BYTEINT), CAST(NULL AS INT64), CAST(NULL AS FLOAT64), ['MIN', 'MAX']) NOT AGGREGATE`],
+  input_rows: `SELECT * FROM UNNEST([STRUCT('a' AS str, [1, 7] AS vals), ('b', [2, 20]), ('a', [4, 10]), ('b', [3, 5])])`,
+  expected_output: `FROM_BASE64('AQEJgxgCzJP/////////fwIAAAAAAAAAhX9AtonH5TQXwR1ShQcBewIAAAAAAAAAFAAAAAAAAAABAAAAAAAAAAoAAAAAAAAA')`
+});
+
+generate_udaf_test("tuple_sketch_int64_array_agg_union", {
+  input_columns: [`sketch`],
+  input_rows: `SELECT * FROM UNNEST([${tuple_array_1}, ${tuple_array_2}]) AS sketch`,
+  expected_output: `FROM_BASE64('AQEJgxgCzJP/////////fwUAAAAAAAAAtwxu5aivQAhOPehbCCvBLoV/QLaJx+U04F817XUdAHMXwR1ShQcBewgAAAAAAAAAUAAAAAAAAAAGAAAAAAAAADwAAAAAAAAAAgAAAAAAAAAUAAAAAAAAAAQAAAAAAAAAKAAAAAAAAAABAAAAAAAAAAoAAAAAAAAA')`
+});
+
+generate_udf_test("tuple_sketch_int64_array_intersection", [{
+  inputs: [ tuple_array_1, tuple_array_2 ],
+  expected_output: `FROM_BASE64('AQEJgxgCzJP/////////fwEAAAAAAAAAtwxu5aivQAgIAAAAAAAAAFAAAAAAAAAA')`
+}]);
+
+generate_udf_test("tuple_sketch_int64_array_intersection_seed_modes", [{
+  inputs: [ tuple_array_1, tuple_array_2, `NULL`, `['MIN', 'MAX']` ],
+  expected_output: `FROM_BASE64('AQEJgxgCzJP/////////fwEAAAAAAAAAtwxu5aivQAgDAAAAAAAAADIAAAAAAAAA')`
+}]);
+
+generate_udf_test("tuple_sketch_int64_array_get_estimate", [{
+  inputs: [ tuple_array_1 ],
+  expected_output: 3
+}]);
+
+generate_udf_test("tuple_sketch_int64_array_get_sum_estimates_and_bounds", [{
+  inputs: [ tuple_array_1, 2 ],
+  expected_output: `[STRUCT(6 AS sum_estimate, 6 AS sum_lower_bound, 6 AS sum_upper_bound), STRUCT(60 AS sum_estimate, 60 AS sum_lower_bound, 60 AS sum_upper_bound)]`
+}]);
@@ -0,0 +1,88 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+# using defaults
+# revenue, clicks and sessions per user in one sketch
+create or replace temp table tuple_sketch(sketch bytes);
+
+insert into tuple_sketch
+(select `$BQ_DATASET`.tuple_sketch_int64_array_agg_int64(value, [mod(value, 100), 1, 2]) from unnest(GENERATE_ARRAY(1, 10000, 1)) as value);
+insert into tuple_sketch
+(select `$BQ_DATASET`.tuple_sketch_int64_array_agg_string(cast(value as string), [mod(value, 100), 1, 2]) from unnest(GENERATE_ARRAY(100000, 110000, 1)) as value);
+
+# expected about 20000
+select `$BQ_DATASET`.tuple_sketch_int64_array_get_estimate(
+  `$BQ_DATASET`.tuple_sketch_int64_array_agg_union(sketch)
+) from tuple_sketch;
+
+# expected sums about 990000, 20000 and 40000
+select `$BQ_DATASET`.tuple_sketch_int64_array_get_sum_estimates_and_bounds(
+  `$BQ_DATASET`.tuple_sketch_int64_array_agg_union(sketch),
+  2
+) from tuple_sketch;
+
+# expected about 0 since int64 and string keys hash differently
+select `$BQ_DATASET`.tuple_sketch_int64_array_get_estimate(
+  `$BQ_DATASET`.tuple_sketch_int64_array_intersection(
+    (select sketch from tuple_sketch limit 1),
+    (select sketch from tuple_sketch limit 1 offset 1)
+  )
+);
+
+drop table tuple_sketch;
+
+# using full signatures
+create or replace temp table tuple_sketch(sketch bytes);
+
+insert into tuple_sketch
+(select `$BQ_DATASET`.tuple_sketch_int64_array_agg_int64_lgk_seed_p_modes(
+  value,
+  [mod(value, 100), mod(value, 100), 1],
+  STRUCT<BYTEINT, INT64, FLOAT64, ARRAY<STRING>>(10, 111, 0.999, ['SUM', 'MAX', 'ONE'])
+) from unnest(GENERATE_ARRAY(1, 10000, 1)) as value);
+insert into tuple_sketch
+(select `$BQ_DATASET`.tuple_sketch_int64_array_agg_string_lgk_seed_p_modes(
+  cast(value as string),
+  [mod(value, 100), mod(value, 100), 1],
+  STRUCT<BYTEINT, INT64, FLOAT64, ARRAY<STRING>>(10, 111, 0.999, ['SUM', 'MAX', 'ONE'])
+) from unnest(GENERATE_ARRAY(100000, 110000, 1)) as value);
+
+# expected about 20000
+select `$BQ_DATASET`.tuple_sketch_int64_array_get_estimate_seed(
+  `$BQ_DATASET`.tuple_sketch_int64_array_agg_union_lgk_seed_modes(sketch, STRUCT<BYTEINT, INT64, ARRAY<STRING>>(10, 111, ['SUM', 'MAX', 'ONE'])),
+  111
+) from tuple_sketch;
+
+select `$BQ_DATASET`.tuple_sketch_int64_array_get_sum_estimates_and_bounds_seed(
+  `$BQ_DATASET`.tuple_sketch_int64_array_agg_union_lgk_seed_modes(sketch, STRUCT<BYTEINT, INT64, ARRAY<STRING>>(10, 111, ['SUM', 'MAX', 'ONE'])),
+  2,
+  111
+) from tuple_sketch;
+
+select `$BQ_DATASET`.tuple_sketch_int64_array_get_estimate_seed(
+  `$BQ_DATASET`.tuple_sketch_int64_array_intersection_seed_modes(
+    (select sketch from tuple_sketch limit 1),
+    (select sketch from tuple_sketch limit 1 offset 1),
+    111,
+    ['SUM', 'MAX', 'ONE']
+  ),
+  111
+);
+
+drop table tuple_sketch;
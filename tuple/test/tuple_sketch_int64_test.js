@@ -76,6 +76,16 @@ generate_udf_test("tuple_sketch_int64_union", [{
   expected_output: tuple_union_1
 }]);
 
+generate_udf_test("tuple_sketch_int64_union_array", [{
+  inputs: [ `CAST(NULL AS ARRAY<BYTES>)` ],
+  expected_output: null
+}]);
+
+generate_udf_test("tuple_sketch_int64_union_array", [{
+  inputs: [ `[${tuple_1}, ${tuple_2}]` ],
+  expected_output: tuple_union_1
+}]);
+
 generate_udf_test("tuple_sketch_int64_get_estimate", [{
   inputs: [ `CAST(NULL AS BYTES)` ],
   expected_output: null
@@ -182,6 +192,20 @@ generate_udf_test("tuple_sketch_int64_jaccard_similarity", [{
   expected_output: `STRUCT(0.2 AS lower_bound, 0.2 AS estimate, 0.2 AS upper_bound)`
 }]);
 
+generate_udf_test("tuple_sketch_int64_jaccard_matrix", [{
+  inputs: [ `CAST(NULL AS ARRAY<BYTES>)` ],
+  expected_output: null
+}]);
+
+generate_udf_test("tuple_sketch_int64_jaccard_matrix", [{
+  inputs: [ `[${tuple_1}, ${tuple_2}, ${tuple_1}]` ],
+  expected_output: `[
+    STRUCT(0 AS index_a, 1 AS index_b, 0.2 AS lower_bound, 0.2 AS estimate, 0.2 AS upper_bound),
+    STRUCT(0 AS index_a, 2 AS index_b, 1.0 AS lower_bound, 1.0 AS estimate, 1.0 AS upper_bound),
+    STRUCT(1 AS index_a, 2 AS index_b, 0.2 AS lower_bound, 0.2 AS estimate, 0.2 AS upper_bound)
+  ]`
+}]);
+
 const tuple_3 = `FROM_BASE64('AgMJAQAazJMDAAAAAAAAABX5fcu9hqEFAQAAAAAAAADDl/wSgXCdHgEAAAAAAAAAukCzwdoGaV0BAAAAAAAAAA==')`;
 
 generate_udaf_test("tuple_sketch_int64_agg_int64", {
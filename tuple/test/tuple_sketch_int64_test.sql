@@ -185,6 +185,22 @@ select `$BQ_DATASET`.tuple_sketch_int64_jaccard_similarity_seed(
   111
 );
 
+# using defaults
+# expected estimates 0.2 (0, 1), 0 (0, 2) and 0.25 (1, 2)
+select `$BQ_DATASET`.tuple_sketch_int64_jaccard_matrix([
+  (select `$BQ_DATASET`.tuple_sketch_int64_agg_string(str, 1) from unnest(["a", "b", "c"]) as str),
+  (select `$BQ_DATASET`.tuple_sketch_int64_agg_string(str, 1) from unnest(["c", "d", "e"]) as str),
+  (select `$BQ_DATASET`.tuple_sketch_int64_agg_string(str, 1) from unnest(["e", "f"]) as str)
+]);
+
+# using full signatures
+# expected estimates 0.2 (0, 1), 0 (0, 2) and 0.25 (1, 2)
+select `$BQ_DATASET`.tuple_sketch_int64_jaccard_matrix_seed([
+  (select `$BQ_DATASET`.tuple_sketch_int64_agg_string_lgk_seed_p_mode(str, 1, STRUCT<BYTEINT, INT64, FLOAT64, STRING>(10, 111, 0.999, "NOP")) from unnest(["a", "b", "c"]) as str),
+  (select `$BQ_DATASET`.tuple_sketch_int64_agg_string_lgk_seed_p_mode(str, 1, STRUCT<BYTEINT, INT64, FLOAT64, STRING>(10, 111, 0.999, "NOP")) from unnest(["c", "d", "e"]) as str),
+  (select `$BQ_DATASET`.tuple_sketch_int64_agg_string_lgk_seed_p_mode(str, 1, STRUCT<BYTEINT, INT64, FLOAT64, STRING>(10, 111, 0.999, "NOP")) from unnest(["e", "f"]) as str)
+], 111);
+
 # using defaults
 # expected 1 entry
 select `$BQ_DATASET`.tuple_sketch_int64_to_string(
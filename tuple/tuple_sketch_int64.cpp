@@ -19,78 +19,19 @@
 
 #include <emscripten/bind.h>
 
-#include <tuple_sketch.hpp>
-#include <tuple_union.hpp>
-#include <tuple_intersection.hpp>
-#include <tuple_a_not_b.hpp>
-#include <tuple_jaccard_similarity.hpp>
-#include <theta_sketch.hpp>
-
-using Summary = uint64_t;
-using Update = uint64_t;
-
-enum tuple_mode {SUM, MIN, MAX, ONE, NOP};
-
-template<typename S, typename U>
-class tuple_update_policy {
-public:
-  tuple_update_policy(tuple_mode mode): mode_(mode) {}
-  Summary create() const {
-    if (mode_ == ONE) return 1;
-    else if (mode_ == MIN) return std::numeric_limits<Summary>::max();
-    else if (mode_ == MAX) return std::numeric_limits<Summary>::min();
-    return 0;
-  }
-  void update(S& summary, const U& update) const {
-    if (mode_ == SUM) summary += update;
-    else if (mode_ == MIN) summary = std::min(summary, update);
-    else if (mode_ == MAX) summary = std::max(summary, update);
-    else if (mode_ == ONE) summary = 1;
-  }
-private:
-  tuple_mode mode_;
-};
-using update_tuple_sketch_int64 = datasketches::update_tuple_sketch<Summary, Update, tuple_update_policy<Summary, Update>>;
-using compact_tuple_sketch_int64 = datasketches::compact_tuple_sketch<Summary>;
-
-template<typename S>
-class tuple_union_policy {
-public:
-  tuple_union_policy(tuple_mode mode): mode_(mode) {}
-  void operator()(Summary& summary, const Summary& other) const {
-    if (mode_ == SUM) summary += other;
-    else if (mode_ == MIN) summary = std::min(summary, other);
-    else if (mode_ == MAX) summary = std::max(summary, other);
-    else if (mode_ == ONE) summary = 1;
-  }
-private:
-  tuple_mode mode_;
-};
-using tuple_union_int64 = datasketches::tuple_union<Summary, tuple_union_policy<Summary>>;
-
-template<typename S> using tuple_intersection_policy = tuple_union_policy<S>;
-using tuple_intersection_int64 = datasketches::tuple_intersection<Summary, tuple_intersection_policy<Summary>>;
-
-using tuple_a_not_b_int64 = datasketches::tuple_a_not_b<Summary>;
-
-template<typename T>
-struct no_op_policy {
-  void operator()(T&, const T&) const {}
-};
-
-using tuple_jaccard_similarity_int64 = datasketches::tuple_jaccard_similarity<Summary, no_op_policy<Summary>, no_op_policy<Summary>>;
-
-tuple_mode convert_mode(const std::string& mode_str) {
-  if (mode_str == "" || mode_str == "SUM") return SUM;
-  if (mode_str == "MIN") return MIN;
-  if (mode_str == "MAX") return MAX;
-  if (mode_str == "ONE") return ONE;
-  if (mode_str == "NOP") return NOP;
-  throw std::invalid_argument("unrecognized mode " + mode_str);
-}
+#include "batch_update.hpp"
+#include "heap_stats.hpp"
+#include "jaccard_matrix.hpp"
+#include "op_stats.hpp"
+#include "serialize_into.hpp"
+#include "tuple_sketch_int64.hpp"
+#include "wrapped_compact_tuple_sketch_int64.hpp"
 
 const emscripten::val Uint8Array = emscripten::val::global("Uint8Array");
+const emscripten::val Float64Array = emscripten::val::global("Float64Array");
 
+// Building with -DQUERY_ONLY=1 (tuple_sketch_int64_query.js) leaves out the update sketch,
+// the union and the set operations, keeping only compact_tuple_sketch_int64 for the scalar UDFs.
 EMSCRIPTEN_BINDINGS(tuple_sketch_int64) {
   emscripten::register_vector<double>("VectorDouble");
 
@@ -98,38 +39,76 @@ EMSCRIPTEN_BINDINGS(tuple_sketch_int64) {
     return std::string(reinterpret_cast<std::exception*>(ptr)->what());
   }));
 
+  emscripten::function("getHeapStats", &get_heap_stats);
+  emscripten::function("getStats", &get_op_stats);
+  emscripten::function("resetStats", &reset_op_stats);
+
   emscripten::constant("DEFAULT_LG_K", datasketches::theta_constants::DEFAULT_LG_K);
   emscripten::constant("DEFAULT_SEED", datasketches::DEFAULT_SEED);
+  emscripten::constant("COMPRESSED_SERIAL_VERSION", compressed_tuple_int64_format::SERIAL_VERSION);
 
+#ifndef QUERY_ONLY
   emscripten::class_<update_tuple_sketch_int64>("update_tuple_sketch_int64")
     .constructor(emscripten::optional_override([](uint8_t lg_k, uint64_t seed, float p, const std::string& mode_str) {
-      const auto policy = tuple_update_policy<Summary, Update>(convert_mode(mode_str));
-      return new update_tuple_sketch_int64(update_tuple_sketch_int64::builder(policy).set_lg_k(lg_k).set_seed(seed).set_p(p).build());
+      return new update_tuple_sketch_int64(lg_k, seed, p, convert_mode(mode_str));
     }))
     .function("updateString", emscripten::optional_override([](update_tuple_sketch_int64& self, const std::string& key, Update value) {
+      OP_STATS_TIMED(UPDATE);
+      OP_STATS_COUNT(ITEMS, 1);
       self.update(key, value);
     }))
     .function("updateInt64", emscripten::optional_override([](update_tuple_sketch_int64& self, uint64_t key, Update value) {
+      OP_STATS_TIMED(UPDATE);
+      OP_STATS_COUNT(ITEMS, 1);
       self.update(key, value);
     }))
+    .function("updateInt64Batch", emscripten::optional_override([](update_tuple_sketch_int64& self, intptr_t keys, intptr_t values, size_t count) {
+      OP_STATS_TIMED(UPDATE);
+      OP_STATS_COUNT(ITEMS, count);
+      self.update_batch(reinterpret_cast<const uint64_t*>(keys), reinterpret_cast<const Update*>(values), count);
+    }))
+    .function("updateStringBatch", emscripten::optional_override([](update_tuple_sketch_int64& self, intptr_t offsets, intptr_t bytes, intptr_t values, size_t count) {
+      OP_STATS_TIMED(UPDATE);
+      OP_STATS_COUNT(ITEMS, count);
+      self.update_batch(packed_items(offsets, bytes, count), reinterpret_cast<const Update*>(values));
+    }))
     .function("serializeAsUint8Array", emscripten::optional_override([](const update_tuple_sketch_int64& self) {
+      OP_STATS_TIMED(SERIALIZE);
       auto bytes = self.compact().serialize();
+      OP_STATS_COUNT(SERIALIZED_BYTES, bytes.size());
+      return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
+    }))
+    .function("serializeInto", emscripten::optional_override([](const update_tuple_sketch_int64& self, intptr_t bytes, size_t capacity) {
+      const auto sketch = self.compact();
+      return serialize_into(bytes, capacity, [&sketch](std::ostream& os) { sketch.serialize(os); });
+    }))
+    .function("serializeAsUint8ArrayCompressed", emscripten::optional_override([](const update_tuple_sketch_int64& self) {
+      OP_STATS_TIMED(SERIALIZE);
+      auto bytes = wrapped_compact_tuple_sketch_int64::serialize_compressed(self.compact());
+      OP_STATS_COUNT(SERIALIZED_BYTES, bytes.size());
       return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
     }))
     ;
+#endif
 
   emscripten::class_<compact_tuple_sketch_int64>("compact_tuple_sketch_int64")
     .class_function("convertTheta", emscripten::optional_override([](const std::string& theta_sketch_bytes, uint64_t value, uint64_t seed) {
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, theta_sketch_bytes.size());
       // converting constructor does not currently take wrapped compact theta sketch
       const auto sketch = datasketches::compact_theta_sketch::deserialize(theta_sketch_bytes.data(), theta_sketch_bytes.size(), seed);
       auto bytes = compact_tuple_sketch_int64(sketch, value).serialize();
       return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
     }))
     .class_function("getEstimate", emscripten::optional_override([](const std::string& sketch_bytes, uint64_t seed) {
-      return compact_tuple_sketch_int64::deserialize(sketch_bytes.data(), sketch_bytes.size(), seed).get_estimate();
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, sketch_bytes.size());
+      return wrapped_compact_tuple_sketch_int64::wrap(sketch_bytes.data(), sketch_bytes.size(), seed).get_estimate();
     }))
     .class_function("getEstimateAndBounds", emscripten::optional_override([](const std::string& sketch_bytes, uint8_t num_std_devs, uint64_t seed) {
-      const auto sketch = compact_tuple_sketch_int64::deserialize(sketch_bytes.data(), sketch_bytes.size(), seed);
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, sketch_bytes.size());
+      const auto sketch = wrapped_compact_tuple_sketch_int64::wrap(sketch_bytes.data(), sketch_bytes.size(), seed);
       auto result =  emscripten::val::object();
       result.set("estimate", sketch.get_estimate());
       result.set("lower_bound", sketch.get_lower_bound(num_std_devs));
@@ -137,7 +116,9 @@ EMSCRIPTEN_BINDINGS(tuple_sketch_int64) {
       return result;
     }))
     .class_function("getSumEstimateAndBounds", emscripten::optional_override([](const std::string& sketch_bytes, uint8_t num_std_devs, uint64_t seed) {
-      const auto sketch = compact_tuple_sketch_int64::deserialize(sketch_bytes.data(), sketch_bytes.size(), seed);
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, sketch_bytes.size());
+      const auto sketch = wrapped_compact_tuple_sketch_int64::wrap(sketch_bytes.data(), sketch_bytes.size(), seed);
       uint64_t sum = 0;
       for (const auto& entry: sketch) sum += entry.second;
       const double sum_estimate = sum / sketch.get_theta();
@@ -148,38 +129,86 @@ EMSCRIPTEN_BINDINGS(tuple_sketch_int64) {
       return result;
     }))
     .class_function("getTheta", emscripten::optional_override([](const std::string& sketch_bytes, uint64_t seed) {
-      return compact_tuple_sketch_int64::deserialize(sketch_bytes.data(), sketch_bytes.size(), seed).get_theta();
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, sketch_bytes.size());
+      return wrapped_compact_tuple_sketch_int64::wrap(sketch_bytes.data(), sketch_bytes.size(), seed).get_theta();
     }))
     .class_function("getNumRetained", emscripten::optional_override([](const std::string& sketch_bytes, uint64_t seed) {
-      return compact_tuple_sketch_int64::deserialize(sketch_bytes.data(), sketch_bytes.size(), seed).get_num_retained();
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, sketch_bytes.size());
+      return wrapped_compact_tuple_sketch_int64::wrap(sketch_bytes.data(), sketch_bytes.size(), seed).get_num_retained();
     }))
+    .class_function("getMaxSerializedSizeBytes", &get_max_serialized_size_bytes)
     .class_function("toString", emscripten::optional_override([](const std::string& sketch_bytes, uint64_t seed) {
-      return compact_tuple_sketch_int64::deserialize(sketch_bytes.data(), sketch_bytes.size(), seed).to_string();
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, sketch_bytes.size());
+      return wrapped_compact_tuple_sketch_int64::deserialize_compact(sketch_bytes.data(), sketch_bytes.size(), seed).to_string();
+    }))
+    .class_function("uncompress", emscripten::optional_override([](const std::string& sketch_bytes, uint64_t seed) {
+      OP_STATS_TIMED(DESERIALIZE);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, sketch_bytes.size());
+      auto bytes = wrapped_compact_tuple_sketch_int64::deserialize_compact(sketch_bytes.data(), sketch_bytes.size(), seed).serialize();
+      return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
     }))
     .class_function("filterLowHigh", emscripten::optional_override([](const std::string& sketch_bytes, int low, int high, uint64_t seed) {
-      auto bytes = compact_tuple_sketch_int64::deserialize(
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, sketch_bytes.size());
+      auto bytes = wrapped_compact_tuple_sketch_int64::wrap(
         sketch_bytes.data(), sketch_bytes.size(), seed
       ).filter([low, high](int v){return v >= low && v <= high;}).serialize();
       return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
     }))
     ;
 
+#ifndef QUERY_ONLY
   emscripten::class_<tuple_union_int64>("tuple_union_int64")
     .constructor(emscripten::optional_override([](uint8_t lg_k, uint64_t seed, std::string mode_str) {
-      const auto policy = tuple_union_policy<Summary>(convert_mode(mode_str));
-      return new tuple_union_int64(tuple_union_int64::builder(policy).set_lg_k(lg_k).set_seed(seed).build());
+      return new tuple_union_int64(lg_k, seed, convert_mode(mode_str));
     }))
     .function("updateWithUpdateSketch", emscripten::optional_override([](tuple_union_int64& self, const update_tuple_sketch_int64& sketch) {
+      OP_STATS_TIMED(MERGE);
+      OP_STATS_COUNT(MERGED_SKETCHES, 1);
       self.update(sketch);
     }))
     .function("updateWithCompactSketch", emscripten::optional_override([](tuple_union_int64& self, const compact_tuple_sketch_int64& sketch) {
+      OP_STATS_TIMED(MERGE);
+      OP_STATS_COUNT(MERGED_SKETCHES, 1);
       self.update(sketch);
     }))
     .function("updateWithBytes", emscripten::optional_override([](tuple_union_int64& self, const std::string& bytes, uint64_t seed) {
-      self.update(compact_tuple_sketch_int64::deserialize(bytes.data(), bytes.size(), seed));
+      OP_STATS_TIMED(MERGE);
+      OP_STATS_COUNT(MERGED_SKETCHES, 1);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
+      self.update(wrapped_compact_tuple_sketch_int64::wrap(bytes.data(), bytes.size(), seed));
+    }))
+    .function("updateWithBuffer", emscripten::optional_override([](tuple_union_int64& self, intptr_t bytes, size_t size, uint64_t seed) {
+      OP_STATS_TIMED(MERGE);
+      OP_STATS_COUNT(MERGED_SKETCHES, 1);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, size);
+      self.update(wrapped_compact_tuple_sketch_int64::wrap(reinterpret_cast<const void*>(bytes), size, seed));
+    }))
+    .function("updateWithPacked", emscripten::optional_override([](tuple_union_int64& self, intptr_t offsets, intptr_t bytes, size_t count, uint64_t seed) {
+      OP_STATS_TIMED(MERGE);
+      OP_STATS_COUNT(MERGED_SKETCHES, count);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, packed_items(offsets, bytes, count).total_size());
+      update_union_packed(self, packed_items(offsets, bytes, count), [seed](const char* data, size_t size) {
+        return wrapped_compact_tuple_sketch_int64::wrap(data, size, seed);
+      });
     }))
     .function("getResultAsUint8Array", emscripten::optional_override([](tuple_union_int64& self) {
+      OP_STATS_TIMED(SERIALIZE);
       auto bytes = self.get_result().serialize();
+      OP_STATS_COUNT(SERIALIZED_BYTES, bytes.size());
+      return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
+    }))
+    .function("getResultInto", emscripten::optional_override([](tuple_union_int64& self, intptr_t bytes, size_t capacity) {
+      const auto sketch = self.get_result();
+      return serialize_into(bytes, capacity, [&sketch](std::ostream& os) { sketch.serialize(os); });
+    }))
+    .function("getResultAsUint8ArrayCompressed", emscripten::optional_override([](tuple_union_int64& self) {
+      OP_STATS_TIMED(SERIALIZE);
+      auto bytes = wrapped_compact_tuple_sketch_int64::serialize_compressed(self.get_result());
+      OP_STATS_COUNT(SERIALIZED_BYTES, bytes.size());
       return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
     }))
     ;
@@ -187,10 +216,11 @@ EMSCRIPTEN_BINDINGS(tuple_sketch_int64) {
   emscripten::function("tupleUnionInt64", emscripten::optional_override([](
     const std::string& bytes1, const std::string& bytes2, uint8_t lg_k, uint64_t seed, const std::string& mode_str
   ) {
-    const auto policy = tuple_union_policy<Summary>(convert_mode(mode_str));
-    auto u = tuple_union_int64(tuple_union_int64::builder(policy).set_lg_k(lg_k).set_seed(seed).build());
-    u.update(compact_tuple_sketch_int64::deserialize(bytes1.data(), bytes1.size(), seed));
-    u.update(compact_tuple_sketch_int64::deserialize(bytes2.data(), bytes2.size(), seed));
+    OP_STATS_TIMED(QUERY);
+    OP_STATS_COUNT(DESERIALIZED_BYTES, bytes1.size() + bytes2.size());
+    tuple_union_int64 u(lg_k, seed, convert_mode(mode_str));
+    u.update(wrapped_compact_tuple_sketch_int64::wrap(bytes1.data(), bytes1.size(), seed));
+    u.update(wrapped_compact_tuple_sketch_int64::wrap(bytes2.data(), bytes2.size(), seed));
     const auto bytes = u.get_result().serialize();
     return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
   }));
@@ -198,27 +228,52 @@ EMSCRIPTEN_BINDINGS(tuple_sketch_int64) {
   emscripten::function("tupleIntersectionInt64", emscripten::optional_override([](
     const std::string& bytes1, const std::string& bytes2, uint64_t seed, const std::string& mode_str
   ) {
-    tuple_intersection_int64 intersection(seed, tuple_intersection_policy<Summary>(convert_mode(mode_str)));
-    intersection.update(compact_tuple_sketch_int64::deserialize(bytes1.data(), bytes1.size(), seed));
-    intersection.update(compact_tuple_sketch_int64::deserialize(bytes2.data(), bytes2.size(), seed));
+    OP_STATS_TIMED(QUERY);
+    OP_STATS_COUNT(DESERIALIZED_BYTES, bytes1.size() + bytes2.size());
+    tuple_intersection_int64 intersection(seed, convert_mode(mode_str));
+    intersection.update(wrapped_compact_tuple_sketch_int64::wrap(bytes1.data(), bytes1.size(), seed));
+    intersection.update(wrapped_compact_tuple_sketch_int64::wrap(bytes2.data(), bytes2.size(), seed));
     const auto bytes = intersection.get_result().serialize();
     return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
   }));
 
   emscripten::function("tupleAnotBInt64", emscripten::optional_override([](const std::string& bytes1, const std::string& bytes2, uint64_t seed) {
+    OP_STATS_TIMED(QUERY);
+    OP_STATS_COUNT(DESERIALIZED_BYTES, bytes1.size() + bytes2.size());
+    // the result is built from the first sketch, so only the second one can be wrapped
     auto bytes = tuple_a_not_b_int64(seed).compute(
-      compact_tuple_sketch_int64::deserialize(bytes1.data(), bytes1.size(), seed),
-      compact_tuple_sketch_int64::deserialize(bytes2.data(), bytes2.size(), seed)
+      wrapped_compact_tuple_sketch_int64::deserialize_compact(bytes1.data(), bytes1.size(), seed),
+      wrapped_compact_tuple_sketch_int64::wrap(bytes2.data(), bytes2.size(), seed)
     ).serialize();
     return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
   }));
 
   emscripten::function("tupleInt64JaccardSimilarity", emscripten::optional_override([](const std::string& bytes1, const std::string& bytes2, uint64_t seed) {
+    OP_STATS_TIMED(QUERY);
+    OP_STATS_COUNT(DESERIALIZED_BYTES, bytes1.size() + bytes2.size());
     const auto arr = tuple_jaccard_similarity_int64::jaccard(
-      compact_tuple_sketch_int64::deserialize(bytes1.data(), bytes1.size(), seed),
-      compact_tuple_sketch_int64::deserialize(bytes2.data(), bytes2.size(), seed),
+      wrapped_compact_tuple_sketch_int64::wrap(bytes1.data(), bytes1.size(), seed),
+      wrapped_compact_tuple_sketch_int64::wrap(bytes2.data(), bytes2.size(), seed),
       seed
     );
     return std::vector<double>{arr[0], arr[1], arr[2]};
   }));
+
+  // upper triangle of the matrix as a flat array: lower bound, estimate and upper bound
+  // for every pair (i, j) with i < j in row-major order
+  emscripten::function("tupleInt64JaccardMatrix", emscripten::optional_override([](intptr_t offsets, intptr_t bytes, size_t count, uint64_t seed) {
+    OP_STATS_TIMED(QUERY);
+    const packed_items items(offsets, bytes, count);
+    OP_STATS_COUNT(DESERIALIZED_BYTES, items.total_size());
+    std::vector<wrapped_compact_tuple_sketch_int64> sketches;
+    sketches.reserve(items.size());
+    for (size_t i = 0; i < items.size(); ++i) {
+      sketches.push_back(wrapped_compact_tuple_sketch_int64::wrap(items.item_data(i), items.item_size(i), seed));
+    }
+    const jaccard_matrix<wrapped_compact_tuple_sketch_int64, tuple_jaccard_similarity_int64> matrix(sketches, seed);
+    std::vector<double> values(matrix.get_num_values());
+    matrix.compute(values.data());
+    return Float64Array.new_(emscripten::typed_memory_view(values.size(), values.data()));
+  }));
+#endif
 }
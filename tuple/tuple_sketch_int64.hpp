@@ -0,0 +1,276 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef TUPLE_SKETCH_INT64_HPP_
+#define TUPLE_SKETCH_INT64_HPP_
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include <tuple_sketch.hpp>
+#include <tuple_union.hpp>
+#include <tuple_intersection.hpp>
+#include <tuple_a_not_b.hpp>
+#include <tuple_jaccard_similarity.hpp>
+#include <theta_sketch.hpp>
+
+#include "batch_update.hpp"
+#include "theta_batch_update.hpp"
+
+#ifdef USE_ARENA_ALLOCATOR
+#include "arena_allocator.hpp"
+#endif
+
+using Summary = uint64_t;
+using Update = uint64_t;
+
+#ifdef USE_ARENA_ALLOCATOR
+using SummaryAllocator = arena_allocator<Summary>;
+#else
+using SummaryAllocator = std::allocator<Summary>;
+#endif
+
+enum tuple_mode {SUM, MIN, MAX, ONE, NOP};
+
+// how a summary starts and how a value is folded into it, one specialization per mode
+template<tuple_mode M> struct tuple_mode_traits;
+
+template<> struct tuple_mode_traits<SUM> {
+  static Summary initial() { return 0; }
+  static void apply(Summary& summary, Summary value) { summary += value; }
+};
+
+template<> struct tuple_mode_traits<MIN> {
+  static Summary initial() { return std::numeric_limits<Summary>::max(); }
+  static void apply(Summary& summary, Summary value) { summary = std::min(summary, value); }
+};
+
+template<> struct tuple_mode_traits<MAX> {
+  static Summary initial() { return std::numeric_limits<Summary>::min(); }
+  static void apply(Summary& summary, Summary value) { summary = std::max(summary, value); }
+};
+
+template<> struct tuple_mode_traits<ONE> {
+  static Summary initial() { return 1; }
+  static void apply(Summary& summary, Summary) { summary = 1; }
+};
+
+template<> struct tuple_mode_traits<NOP> {
+  static Summary initial() { return 0; }
+  static void apply(Summary&, Summary) {}
+};
+
+template<tuple_mode M>
+class tuple_update_policy {
+public:
+  Summary create() const { return tuple_mode_traits<M>::initial(); }
+  void update(Summary& summary, const Update& update) const { tuple_mode_traits<M>::apply(summary, update); }
+};
+
+template<tuple_mode M>
+class tuple_union_policy {
+public:
+  void operator()(Summary& summary, const Summary& other) const { tuple_mode_traits<M>::apply(summary, other); }
+};
+
+template<tuple_mode M> using tuple_intersection_policy = tuple_union_policy<M>;
+
+template<tuple_mode M> using update_tuple_sketch_int64_mode = datasketches::update_tuple_sketch<Summary, Update, tuple_update_policy<M>, SummaryAllocator>;
+template<tuple_mode M> using tuple_union_int64_mode = datasketches::tuple_union<Summary, tuple_union_policy<M>, SummaryAllocator>;
+template<tuple_mode M> using tuple_intersection_int64_mode = datasketches::tuple_intersection<Summary, tuple_intersection_policy<M>, SummaryAllocator>;
+
+using compact_tuple_sketch_int64 = datasketches::compact_tuple_sketch<Summary, SummaryAllocator>;
+
+// same entries as a compact theta sketch, each followed by a summary
+inline size_t get_max_serialized_size_bytes(uint8_t lg_k) {
+  const size_t theta_preamble_bytes = 3 * sizeof(uint64_t);
+  const size_t max_entries = (datasketches::compact_theta_sketch::get_max_serialized_size_bytes(lg_k) - theta_preamble_bytes) / sizeof(uint64_t);
+  return theta_preamble_bytes + max_entries * (sizeof(uint64_t) + sizeof(Summary));
+}
+
+template<template<tuple_mode> class T>
+using tuple_mode_variant = std::variant<T<SUM>, T<MIN>, T<MAX>, T<ONE>, T<NOP>>;
+
+/**
+ * Calls make(std::integral_constant<tuple_mode, M>()) for the given runtime mode
+ * and returns the result as a variant over all modes.
+ * This is the only place where the mode is looked at at runtime.
+ */
+template<template<tuple_mode> class T, typename Make>
+tuple_mode_variant<T> make_for_mode(tuple_mode mode, Make&& make) {
+  switch (mode) {
+    case SUM: return make(std::integral_constant<tuple_mode, SUM>());
+    case MIN: return make(std::integral_constant<tuple_mode, MIN>());
+    case MAX: return make(std::integral_constant<tuple_mode, MAX>());
+    case ONE: return make(std::integral_constant<tuple_mode, ONE>());
+    case NOP: return make(std::integral_constant<tuple_mode, NOP>());
+  }
+  throw std::invalid_argument("unrecognized mode");
+}
+
+/**
+ * Update tuple sketch with int64 summaries.
+ * Holds the sketch specialized for its mode, chosen once at construction,
+ * so that updates do not branch on the mode.
+ */
+class update_tuple_sketch_int64 {
+public:
+  update_tuple_sketch_int64(uint8_t lg_k, uint64_t seed, float p, tuple_mode mode):
+    seed_(seed),
+    sketch_(make_for_mode<update_tuple_sketch_int64_mode>(mode, [&](auto m) {
+      using sketch_type = update_tuple_sketch_int64_mode<decltype(m)::value>;
+      return typename sketch_type::builder().set_lg_k(lg_k).set_seed(seed).set_p(p).build();
+    })) {}
+
+  void update(const std::string& key, Update value) {
+    std::visit([&](auto& sketch) { sketch.update(key, value); }, sketch_);
+  }
+
+  void update(uint64_t key, Update value) {
+    std::visit([&](auto& sketch) { sketch.update(key, value); }, sketch_);
+  }
+
+  /**
+   * Updates the sketch with parallel arrays of keys and values.
+   * The mode is dispatched once for the whole batch, and keys that hash at or above theta
+   * are screened out in blocks before touching the hash table (see theta_batch_update.hpp).
+   * The result is identical to calling update(keys[i], values[i]) for every i.
+   */
+  void update_batch(const uint64_t* keys, const Update* values, size_t count) {
+    std::visit([&](auto& sketch) {
+      update_int64_batch_screened(sketch, keys, count, seed_, [&sketch, keys, values](size_t i) {
+        sketch.update(keys[i], values[i]);
+      });
+    }, sketch_);
+  }
+
+  /**
+   * Updates the sketch with packed string keys and a parallel array of values.
+   * Empty keys are skipped to match update(const std::string&, Update).
+   */
+  void update_batch(const packed_items& keys, const Update* values) {
+    std::visit([&](auto& sketch) {
+      for (size_t i = 0; i < keys.size(); ++i) {
+        const size_t size = keys.item_size(i);
+        if (size > 0) sketch.update(keys.item_data(i), size, values[i]);
+      }
+    }, sketch_);
+  }
+
+  double get_estimate() const {
+    return std::visit([](const auto& sketch) { return sketch.get_estimate(); }, sketch_);
+  }
+
+  compact_tuple_sketch_int64 compact(bool ordered = true) const {
+    return std::visit([ordered](const auto& sketch) { return sketch.compact(ordered); }, sketch_);
+  }
+
+  /**
+   * Calls f with the sketch specialized for the mode.
+   * Batch operations use this to dispatch on the mode once per batch.
+   */
+  template<typename F>
+  decltype(auto) visit(F&& f) { return std::visit(std::forward<F>(f), sketch_); }
+
+  template<typename F>
+  decltype(auto) visit(F&& f) const { return std::visit(std::forward<F>(f), sketch_); }
+
+private:
+  uint64_t seed_;
+  tuple_mode_variant<update_tuple_sketch_int64_mode> sketch_;
+};
+
+/**
+ * Tuple union with int64 summaries specialized for its mode at construction.
+ */
+class tuple_union_int64 {
+public:
+  tuple_union_int64(uint8_t lg_k, uint64_t seed, tuple_mode mode):
+    union_(make_for_mode<tuple_union_int64_mode>(mode, [&](auto m) {
+      using union_type = tuple_union_int64_mode<decltype(m)::value>;
+      return typename union_type::builder().set_lg_k(lg_k).set_seed(seed).build();
+    })) {}
+
+  template<typename Sketch, typename = typename std::enable_if<
+    !std::is_same<typename std::decay<Sketch>::type, update_tuple_sketch_int64>::value
+  >::type>
+  void update(Sketch&& sketch) {
+    std::visit([&sketch](auto& u) { u.update(std::forward<Sketch>(sketch)); }, union_);
+  }
+
+  void update(const update_tuple_sketch_int64& sketch) {
+    sketch.visit([this](const auto& s) { update(s); });
+  }
+
+  compact_tuple_sketch_int64 get_result(bool ordered = true) const {
+    return std::visit([ordered](const auto& u) { return u.get_result(ordered); }, union_);
+  }
+
+private:
+  tuple_mode_variant<tuple_union_int64_mode> union_;
+};
+
+/**
+ * Tuple intersection with int64 summaries specialized for its mode at construction.
+ */
+class tuple_intersection_int64 {
+public:
+  tuple_intersection_int64(uint64_t seed, tuple_mode mode):
+    intersection_(make_for_mode<tuple_intersection_int64_mode>(mode, [seed](auto m) {
+      constexpr tuple_mode M = decltype(m)::value;
+      return tuple_intersection_int64_mode<M>(seed, tuple_intersection_policy<M>());
+    })) {}
+
+  template<typename Sketch>
+  void update(Sketch&& sketch) {
+    std::visit([&sketch](auto& i) { i.update(std::forward<Sketch>(sketch)); }, intersection_);
+  }
+
+  compact_tuple_sketch_int64 get_result(bool ordered = true) const {
+    return std::visit([ordered](const auto& i) { return i.get_result(ordered); }, intersection_);
+  }
+
+private:
+  tuple_mode_variant<tuple_intersection_int64_mode> intersection_;
+};
+
+using tuple_a_not_b_int64 = datasketches::tuple_a_not_b<Summary, SummaryAllocator>;
+
+template<typename T>
+struct no_op_policy {
+  void operator()(T&, const T&) const {}
+};
+
+using tuple_jaccard_similarity_int64 = datasketches::tuple_jaccard_similarity<Summary, no_op_policy<Summary>, no_op_policy<Summary>, SummaryAllocator>;
+
+inline tuple_mode convert_mode(const std::string& mode_str) {
+  if (mode_str == "" || mode_str == "SUM") return SUM;
+  if (mode_str == "MIN") return MIN;
+  if (mode_str == "MAX") return MAX;
+  if (mode_str == "ONE") return ONE;
+  if (mode_str == "NOP") return NOP;
+  throw std::invalid_argument("unrecognized mode " + mode_str);
+}
+
+#endif
@@ -0,0 +1,148 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <emscripten/bind.h>
+
+#include "batch_update.hpp"
+#include "heap_stats.hpp"
+#include "op_stats.hpp"
+#include "serialize_into.hpp"
+#include "tuple_sketch_int64_array.hpp"
+
+const emscripten::val Uint8Array = emscripten::val::global("Uint8Array");
+
+static std::vector<tuple_mode> convert_modes(const emscripten::val& modes) {
+  return convert_modes(emscripten::vecFromJSArray<std::string>(modes));
+}
+
+EMSCRIPTEN_BINDINGS(tuple_sketch_int64_array) {
+  emscripten::function("getExceptionMessage", emscripten::optional_override([](intptr_t ptr) {
+    return std::string(reinterpret_cast<std::exception*>(ptr)->what());
+  }));
+
+  emscripten::function("getHeapStats", &get_heap_stats);
+  emscripten::function("getStats", &get_op_stats);
+  emscripten::function("resetStats", &reset_op_stats);
+
+  emscripten::constant("DEFAULT_LG_K", datasketches::theta_constants::DEFAULT_LG_K);
+  emscripten::constant("DEFAULT_SEED", datasketches::DEFAULT_SEED);
+
+  // values are passed in column-major order: the value of column c for key i is values[c * count + i]
+  emscripten::class_<update_tuple_sketch_int64_array>("update_tuple_sketch_int64_array")
+    .constructor(emscripten::optional_override([](uint8_t lg_k, uint64_t seed, float p, const emscripten::val& modes) {
+      return new update_tuple_sketch_int64_array(lg_k, seed, p, convert_modes(modes));
+    }))
+    .function("getNumValues", &update_tuple_sketch_int64_array::get_num_values)
+    .function("updateInt64Batch", emscripten::optional_override([](update_tuple_sketch_int64_array& self, intptr_t keys, intptr_t values, size_t count) {
+      OP_STATS_TIMED(UPDATE);
+      OP_STATS_COUNT(ITEMS, count);
+      self.update_batch(reinterpret_cast<const uint64_t*>(keys), reinterpret_cast<const int64_t*>(values), count);
+    }))
+    .function("updateStringBatch", emscripten::optional_override([](update_tuple_sketch_int64_array& self, intptr_t offsets, intptr_t bytes, intptr_t values, size_t count) {
+      OP_STATS_TIMED(UPDATE);
+      OP_STATS_COUNT(ITEMS, count);
+      self.update_batch(packed_items(offsets, bytes, count), reinterpret_cast<const int64_t*>(values));
+    }))
+    .function("serializeAsUint8Array", emscripten::optional_override([](const update_tuple_sketch_int64_array& self) {
+      OP_STATS_TIMED(SERIALIZE);
+      auto bytes = serialize_int64_array(self.compact());
+      OP_STATS_COUNT(SERIALIZED_BYTES, bytes.size());
+      return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
+    }))
+    .function("serializeInto", emscripten::optional_override([](const update_tuple_sketch_int64_array& self, intptr_t bytes, size_t capacity) {
+      const auto sketch = self.compact();
+      return serialize_into(bytes, capacity, [&sketch](std::ostream& os) { serialize_int64_array(sketch, os); });
+    }))
+    ;
+
+  emscripten::class_<compact_tuple_sketch_int64_array>("compact_tuple_sketch_int64_array")
+    .class_function("getEstimate", emscripten::optional_override([](const std::string& sketch_bytes, uint64_t seed) {
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, sketch_bytes.size());
+      return wrapped_compact_tuple_sketch_int64_array::wrap(sketch_bytes.data(), sketch_bytes.size(), seed).get_estimate();
+    }))
+    .class_function("getNumValues", emscripten::optional_override([](const std::string& sketch_bytes, uint64_t seed) {
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, sketch_bytes.size());
+      return wrapped_compact_tuple_sketch_int64_array::wrap(sketch_bytes.data(), sketch_bytes.size(), seed).get_num_values();
+    }))
+    // one {sum_estimate, sum_lower_bound, sum_upper_bound} object per value column
+    .class_function("getSumEstimatesAndBounds", emscripten::optional_override([](const std::string& sketch_bytes, uint8_t num_std_devs, uint64_t seed) {
+      OP_STATS_TIMED(QUERY);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, sketch_bytes.size());
+      const auto sketch = wrapped_compact_tuple_sketch_int64_array::wrap(sketch_bytes.data(), sketch_bytes.size(), seed);
+      const double estimate = sketch.get_estimate();
+      const double lower_bound = sketch.get_lower_bound(num_std_devs);
+      const double upper_bound = sketch.get_upper_bound(num_std_devs);
+      auto result = emscripten::val::array();
+      for (uint8_t i = 0; i < sketch.get_num_values(); ++i) {
+        const double sum_estimate = sketch.get_sum(i) / sketch.get_theta();
+        auto column = emscripten::val::object();
+        column.set("sum_estimate", sum_estimate);
+        column.set("sum_lower_bound", estimate > 0 ? (sum_estimate * lower_bound / estimate) : 0);
+        column.set("sum_upper_bound", estimate > 0 ? (sum_estimate * upper_bound / estimate) : 0);
+        result.call<void>("push", column);
+      }
+      return result;
+    }))
+    .class_function("getMaxSerializedSizeBytes", emscripten::optional_override([](uint8_t lg_k, uint8_t num_values) {
+      return get_max_serialized_size_bytes(lg_k, num_values);
+    }))
+    ;
+
+  emscripten::class_<tuple_union_int64_array>("tuple_union_int64_array")
+    .constructor(emscripten::optional_override([](uint8_t lg_k, uint64_t seed, const emscripten::val& modes) {
+      return new tuple_union_int64_array(lg_k, seed, convert_modes(modes));
+    }))
+    .function("getNumValues", &tuple_union_int64_array::get_num_values)
+    .function("updateWithUpdateSketch", emscripten::optional_override([](tuple_union_int64_array& self, const update_tuple_sketch_int64_array& sketch) {
+      OP_STATS_TIMED(MERGE);
+      OP_STATS_COUNT(MERGED_SKETCHES, 1);
+      self.update(sketch);
+    }))
+    .function("updateWithBytes", emscripten::optional_override([](tuple_union_int64_array& self, const std::string& bytes, uint64_t seed) {
+      OP_STATS_TIMED(MERGE);
+      OP_STATS_COUNT(MERGED_SKETCHES, 1);
+      OP_STATS_COUNT(DESERIALIZED_BYTES, bytes.size());
+      self.update(deserialize_int64_array(bytes.data(), bytes.size(), seed));
+    }))
+    .function("getResultAsUint8Array", emscripten::optional_override([](tuple_union_int64_array& self) {
+      OP_STATS_TIMED(SERIALIZE);
+      auto bytes = serialize_int64_array(self.get_result());
+      OP_STATS_COUNT(SERIALIZED_BYTES, bytes.size());
+      return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
+    }))
+    .function("getResultInto", emscripten::optional_override([](tuple_union_int64_array& self, intptr_t bytes, size_t capacity) {
+      const auto sketch = self.get_result();
+      return serialize_into(bytes, capacity, [&sketch](std::ostream& os) { serialize_int64_array(sketch, os); });
+    }))
+    ;
+
+  emscripten::function("tupleIntersectionInt64Array", emscripten::optional_override([](
+    const std::string& bytes1, const std::string& bytes2, uint64_t seed, const emscripten::val& modes
+  ) {
+    OP_STATS_TIMED(QUERY);
+    OP_STATS_COUNT(DESERIALIZED_BYTES, bytes1.size() + bytes2.size());
+    tuple_intersection_int64_array intersection(seed, convert_modes(modes));
+    intersection.update(deserialize_int64_array(bytes1.data(), bytes1.size(), seed));
+    intersection.update(deserialize_int64_array(bytes2.data(), bytes2.size(), seed));
+    const auto bytes = serialize_int64_array(intersection.get_result());
+    return Uint8Array.new_(emscripten::typed_memory_view(bytes.size(), bytes.data()));
+  }));
+}
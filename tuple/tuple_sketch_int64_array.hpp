@@ -0,0 +1,416 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef TUPLE_SKETCH_INT64_ARRAY_HPP_
+#define TUPLE_SKETCH_INT64_ARRAY_HPP_
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <array_tuple_sketch.hpp>
+#include <array_tuple_union.hpp>
+#include <array_tuple_intersection.hpp>
+#include <binomial_bounds.hpp>
+#include <theta_sketch.hpp>
+
+#include "batch_update.hpp"
+#include "theta_batch_update.hpp"
+#include "tuple_sketch_int64.hpp"
+
+/*
+ * Tuple sketch with a fixed number of int64 values per key, for example revenue, clicks and sessions
+ * per distinct user in one sketch instead of three. Every value column has its own mode
+ * (SUM, MIN, MAX or ONE, see tuple_mode in tuple_sketch_int64.hpp), the number of columns is
+ * the number of modes and is fixed for the lifetime of the sketch (at most 255).
+ * The sketches use the array tuple sketch of the library, so they are serialized in the same
+ * layout as the array of doubles sketch, with the number of values in the preamble,
+ * but the values are signed 64-bit integers. To keep the two apart, the serialized sketches
+ * carry their own sketch type (see serialize_int64_array and deserialize_int64_array).
+ */
+
+using int64_array = datasketches::array<int64_t>;
+
+// values of one row in a column-major buffer: column c is at values[c * stride]
+struct int64_array_row {
+  const int64_t* values;
+  size_t stride;
+
+  int64_t operator[](size_t column) const { return values[column * stride]; }
+};
+
+// initial value and folding of one column, signed counterparts of tuple_mode_traits
+inline int64_t int64_array_initial(tuple_mode mode) {
+  switch (mode) {
+    case MIN: return std::numeric_limits<int64_t>::max();
+    case MAX: return std::numeric_limits<int64_t>::min();
+    case ONE: return 1;
+    default: return 0;
+  }
+}
+
+inline void int64_array_apply(tuple_mode mode, int64_t& summary, int64_t value) {
+  switch (mode) {
+    case SUM: summary += value; break;
+    case MIN: summary = std::min(summary, value); break;
+    case MAX: summary = std::max(summary, value); break;
+    case ONE: summary = 1; break;
+    case NOP: break;
+  }
+}
+
+/**
+ * Column modes shared by the update, union and intersection policies.
+ */
+class int64_array_modes {
+public:
+  explicit int64_array_modes(std::vector<tuple_mode> modes): modes_(std::move(modes)) {
+    if (modes_.empty() || modes_.size() > std::numeric_limits<uint8_t>::max()) {
+      throw std::invalid_argument("number of values must be in the range [1, 255], got " + std::to_string(modes_.size()));
+    }
+  }
+
+  uint8_t get_num_values() const { return static_cast<uint8_t>(modes_.size()); }
+
+  template<typename Values>
+  void apply(int64_array& summary, const Values& values) const {
+    for (size_t i = 0; i < modes_.size(); ++i) int64_array_apply(modes_[i], summary[i], values[i]);
+  }
+
+  int64_array create() const {
+    int64_array summary(get_num_values(), 0);
+    for (size_t i = 0; i < modes_.size(); ++i) summary[i] = int64_array_initial(modes_[i]);
+    return summary;
+  }
+
+private:
+  std::vector<tuple_mode> modes_;
+};
+
+class int64_array_update_policy {
+public:
+  explicit int64_array_update_policy(const int64_array_modes& modes): modes_(modes) {}
+  int64_array create() const { return modes_.create(); }
+  template<typename Values>
+  void update(int64_array& summary, const Values& values) const { modes_.apply(summary, values); }
+  uint8_t get_num_values() const { return modes_.get_num_values(); }
+
+private:
+  int64_array_modes modes_;
+};
+
+class int64_array_union_policy {
+public:
+  explicit int64_array_union_policy(const int64_array_modes& modes): modes_(modes) {}
+  void operator()(int64_array& summary, const int64_array& other) const { modes_.apply(summary, other); }
+  uint8_t get_num_values() const { return modes_.get_num_values(); }
+
+private:
+  int64_array_modes modes_;
+};
+
+using int64_array_intersection_policy = int64_array_union_policy;
+
+using update_tuple_sketch_int64_array_base = datasketches::update_array_tuple_sketch<int64_array, int64_array_update_policy>;
+using compact_tuple_sketch_int64_array = datasketches::compact_array_tuple_sketch<int64_array>;
+using tuple_union_int64_array_base = datasketches::array_tuple_union<int64_array, int64_array_union_policy>;
+using tuple_intersection_int64_array_base = datasketches::array_tuple_intersection<int64_array, int64_array_intersection_policy>;
+
+inline std::vector<tuple_mode> convert_modes(const std::vector<std::string>& mode_strs) {
+  std::vector<tuple_mode> modes;
+  modes.reserve(mode_strs.size());
+  for (const auto& mode_str: mode_strs) modes.push_back(convert_mode(mode_str));
+  return modes;
+}
+
+// same entries as a compact theta sketch, each followed by the values
+inline size_t get_max_serialized_size_bytes(uint8_t lg_k, uint8_t num_values) {
+  const size_t theta_preamble_bytes = 3 * sizeof(uint64_t);
+  const size_t max_entries = (datasketches::compact_theta_sketch::get_max_serialized_size_bytes(lg_k) - theta_preamble_bytes) / sizeof(uint64_t);
+  return theta_preamble_bytes + max_entries * (sizeof(uint64_t) + num_values * sizeof(int64_t));
+}
+
+// sketch type byte of the serialized compact array of doubles sketch and of these sketches,
+// which share the rest of the layout
+static const size_t TUPLE_SKETCH_TYPE_OFFSET = 3;
+static const uint8_t ARRAY_OF_DOUBLES_SKETCH_TYPE = 3;
+static const uint8_t INT64_ARRAY_SKETCH_TYPE = 0x80 | ARRAY_OF_DOUBLES_SKETCH_TYPE;
+
+inline std::vector<uint8_t> serialize_int64_array(const compact_tuple_sketch_int64_array& sketch) {
+  auto bytes = sketch.serialize();
+  bytes[TUPLE_SKETCH_TYPE_OFFSET] = INT64_ARRAY_SKETCH_TYPE;
+  return bytes;
+}
+
+// the stream must be seekable, such as the one of serialize_into
+inline void serialize_int64_array(const compact_tuple_sketch_int64_array& sketch, std::ostream& os) {
+  const auto start = os.tellp();
+  sketch.serialize(os);
+  const auto end = os.tellp();
+  os.seekp(start + static_cast<std::streamoff>(TUPLE_SKETCH_TYPE_OFFSET));
+  os.put(static_cast<char>(INT64_ARRAY_SKETCH_TYPE));
+  os.seekp(end);
+}
+
+// array of doubles sketches are rejected, their values would be read as integers
+inline void check_int64_array_sketch_type(const uint8_t* ptr, size_t size) {
+  if (size <= TUPLE_SKETCH_TYPE_OFFSET) {
+    throw std::invalid_argument("at least " + std::to_string(TUPLE_SKETCH_TYPE_OFFSET + 1) + " bytes expected, got " + std::to_string(size));
+  }
+  const uint8_t sketch_type = ptr[TUPLE_SKETCH_TYPE_OFFSET];
+  if (sketch_type == ARRAY_OF_DOUBLES_SKETCH_TYPE) {
+    throw std::invalid_argument("array of doubles tuple sketches are not supported, expected a tuple sketch with int64 array summaries");
+  }
+  if (sketch_type != INT64_ARRAY_SKETCH_TYPE) {
+    throw std::invalid_argument("sketch type mismatch: expected " + std::to_string(INT64_ARRAY_SKETCH_TYPE) + ", got " + std::to_string(sketch_type));
+  }
+}
+
+/**
+ * Deserializes a sketch produced by serialize_int64_array, for unions and intersections
+ * that need a library sketch. Scalar queries use wrapped_compact_tuple_sketch_int64_array instead.
+ */
+inline compact_tuple_sketch_int64_array deserialize_int64_array(const void* bytes, size_t size, uint64_t seed) {
+  const uint8_t* ptr = static_cast<const uint8_t*>(bytes);
+  check_int64_array_sketch_type(ptr, size);
+  // the library only reads its own sketch type
+  std::vector<uint8_t> copy(ptr, ptr + size);
+  copy[TUPLE_SKETCH_TYPE_OFFSET] = ARRAY_OF_DOUBLES_SKETCH_TYPE;
+  return compact_tuple_sketch_int64_array::deserialize(copy.data(), copy.size(), seed);
+}
+
+/**
+ * Read-only view of a sketch produced by serialize_int64_array.
+ * Like wrapped_compact_tuple_sketch_int64, it validates the preamble and reads the values in place,
+ * so the scalar queries neither copy nor deserialize the sketch.
+ * The preamble is one long: preamble longs, serial version, family, sketch type, flags,
+ * number of values and seed hash, followed by theta. With entries, the number of entries
+ * and 4 unused bytes come next, then all hashes and then the values of each entry in turn.
+ * The bytes must outlive the view.
+ */
+class wrapped_compact_tuple_sketch_int64_array {
+public:
+  static wrapped_compact_tuple_sketch_int64_array wrap(const void* bytes, size_t size, uint64_t seed) {
+    const uint8_t* ptr = static_cast<const uint8_t*>(bytes);
+    check_int64_array_sketch_type(ptr, size);
+    check_size(size, THETA_OFFSET + sizeof(uint64_t));
+    if (ptr[1] != SERIAL_VERSION) {
+      throw std::invalid_argument("serial version mismatch: expected " + std::to_string(SERIAL_VERSION) + ", actual " + std::to_string(ptr[1]));
+    }
+    if (ptr[2] != FAMILY) {
+      throw std::invalid_argument("family mismatch: expected " + std::to_string(FAMILY) + ", actual " + std::to_string(ptr[2]));
+    }
+    const uint8_t flags = ptr[4];
+    const bool is_empty = flags & (1 << IS_EMPTY);
+    const uint8_t num_values = ptr[5];
+    uint16_t seed_hash;
+    std::memcpy(&seed_hash, ptr + SEED_HASH_OFFSET, sizeof(seed_hash));
+    if (!is_empty && seed_hash != datasketches::compute_seed_hash(seed)) throw std::invalid_argument("seed hash mismatch");
+    uint64_t theta;
+    std::memcpy(&theta, ptr + THETA_OFFSET, sizeof(theta));
+    uint32_t num_entries = 0;
+    if (flags & (1 << HAS_ENTRIES)) {
+      check_size(size, ENTRIES_OFFSET);
+      std::memcpy(&num_entries, ptr + NUM_ENTRIES_OFFSET, sizeof(num_entries));
+      check_size(size, ENTRIES_OFFSET + static_cast<size_t>(num_entries) * (1 + num_values) * sizeof(uint64_t));
+    }
+    const uint8_t* values = ptr + ENTRIES_OFFSET + static_cast<size_t>(num_entries) * sizeof(uint64_t);
+    return wrapped_compact_tuple_sketch_int64_array(is_empty, num_values, num_entries, theta, values);
+  }
+
+  bool is_empty() const { return is_empty_; }
+  uint8_t get_num_values() const { return num_values_; }
+  uint32_t get_num_retained() const { return num_entries_; }
+  double get_theta() const { return static_cast<double>(theta_) / datasketches::theta_constants::MAX_THETA; }
+  bool is_estimation_mode() const { return theta_ < datasketches::theta_constants::MAX_THETA && !is_empty_; }
+  double get_estimate() const { return get_num_retained() / get_theta(); }
+
+  double get_lower_bound(uint8_t num_std_devs) const {
+    if (!is_estimation_mode()) return get_num_retained();
+    return datasketches::binomial_bounds::get_lower_bound(get_num_retained(), get_theta(), num_std_devs);
+  }
+
+  double get_upper_bound(uint8_t num_std_devs) const {
+    if (!is_estimation_mode()) return get_num_retained();
+    return datasketches::binomial_bounds::get_upper_bound(get_num_retained(), get_theta(), num_std_devs, is_empty());
+  }
+
+  // sum of one value column over the retained entries
+  int64_t get_sum(uint8_t column) const {
+    int64_t sum = 0;
+    for (uint32_t i = 0; i < num_entries_; ++i) {
+      int64_t value;
+      std::memcpy(&value, values_ + (static_cast<size_t>(i) * num_values_ + column) * sizeof(int64_t), sizeof(value));
+      sum += value;
+    }
+    return sum;
+  }
+
+private:
+  static const uint8_t SERIAL_VERSION = 1;
+  static const uint8_t FAMILY = 9;
+  static const size_t SEED_HASH_OFFSET = 6;
+  static const size_t THETA_OFFSET = 8;
+  static const size_t NUM_ENTRIES_OFFSET = 16;
+  static const size_t ENTRIES_OFFSET = 24;
+  enum flags { IS_BIG_ENDIAN, IS_READ_ONLY, IS_EMPTY, HAS_ENTRIES, IS_ORDERED };
+
+  bool is_empty_;
+  uint8_t num_values_;
+  uint32_t num_entries_;
+  uint64_t theta_;
+  const uint8_t* values_;
+
+  wrapped_compact_tuple_sketch_int64_array(bool is_empty, uint8_t num_values, uint32_t num_entries, uint64_t theta, const uint8_t* values):
+    is_empty_(is_empty), num_values_(num_values), num_entries_(num_entries), theta_(theta), values_(values) {}
+
+  static void check_size(size_t actual, size_t expected) {
+    if (actual < expected) {
+      throw std::out_of_range("at least " + std::to_string(expected) + " bytes expected, actual " + std::to_string(actual));
+    }
+  }
+};
+
+inline void check_num_values(uint8_t expected, uint8_t actual) {
+  if (expected != actual) {
+    throw std::invalid_argument("number of values mismatch: expected " + std::to_string(expected) + ", got " + std::to_string(actual));
+  }
+}
+
+/**
+ * Update sketch with int64 array summaries, one value per column mode.
+ */
+class update_tuple_sketch_int64_array: public update_tuple_sketch_int64_array_base {
+public:
+  update_tuple_sketch_int64_array(uint8_t lg_k, uint64_t seed, float p, const std::vector<tuple_mode>& modes):
+    update_tuple_sketch_int64_array_base(update_tuple_sketch_int64_array_base::builder(int64_array_update_policy(int64_array_modes(modes)))
+      .set_lg_k(lg_k).set_seed(seed).set_p(p).build()),
+    seed_(seed) {}
+
+  /**
+   * Updates the sketch with an array of keys and the values in column-major order:
+   * the value of column c for keys[i] is values[c * count + i].
+   * The result is identical to updating the sketch with every key and its row of values.
+   */
+  void update_batch(const uint64_t* keys, const int64_t* values, size_t count) {
+    update_int64_batch_screened(*this, keys, count, seed_, [this, keys, values, count](size_t i) {
+      update(keys[i], int64_array_row{values + i, count});
+    });
+  }
+
+  /**
+   * Updates the sketch with packed string keys and the values in column-major order.
+   * Empty keys are skipped to match update(const std::string&, values).
+   */
+  void update_batch(const packed_items& keys, const int64_t* values) {
+    for (size_t i = 0; i < keys.size(); ++i) {
+      const size_t size = keys.item_size(i);
+      if (size > 0) update(keys.item_data(i), size, int64_array_row{values + i, keys.size()});
+    }
+  }
+
+private:
+  uint64_t seed_;
+};
+
+/**
+ * Union of sketches with int64 array summaries.
+ * Without modes, every column is summed and the number of columns is taken from the first sketch.
+ */
+class tuple_union_int64_array {
+public:
+  tuple_union_int64_array(uint8_t lg_k, uint64_t seed, const std::vector<tuple_mode>& modes):
+    lg_k_(lg_k), seed_(seed), modes_(modes), num_values_(0) {
+    if (!modes_.empty()) init(modes_.size());
+  }
+
+  template<typename Sketch>
+  void update(const Sketch& sketch) {
+    if (!union_) init(sketch.get_num_values());
+    check_num_values(num_values_, sketch.get_num_values());
+    union_->update(sketch);
+  }
+
+  compact_tuple_sketch_int64_array get_result(bool ordered = true) const {
+    if (!union_) throw std::logic_error("the number of values is unknown: no modes and no sketches");
+    return union_->get_result(ordered);
+  }
+
+  // 0 until the number of values is known
+  uint8_t get_num_values() const { return num_values_; }
+
+private:
+  uint8_t lg_k_;
+  uint64_t seed_;
+  std::vector<tuple_mode> modes_;
+  uint8_t num_values_;
+  std::unique_ptr<tuple_union_int64_array_base> union_;
+
+  void init(size_t num_values) {
+    if (modes_.empty()) modes_.assign(num_values, SUM);
+    const int64_array_modes modes(modes_);
+    num_values_ = modes.get_num_values();
+    union_.reset(new tuple_union_int64_array_base(
+      tuple_union_int64_array_base::builder(int64_array_union_policy(modes)).set_lg_k(lg_k_).set_seed(seed_).build()
+    ));
+  }
+};
+
+/**
+ * Intersection of sketches with int64 array summaries.
+ * Without modes, every column is summed and the number of columns is taken from the first sketch.
+ */
+class tuple_intersection_int64_array {
+public:
+  tuple_intersection_int64_array(uint64_t seed, const std::vector<tuple_mode>& modes): seed_(seed), modes_(modes), num_values_(0) {
+    if (!modes_.empty()) init(modes_.size());
+  }
+
+  template<typename Sketch>
+  void update(const Sketch& sketch) {
+    if (!intersection_) init(sketch.get_num_values());
+    check_num_values(num_values_, sketch.get_num_values());
+    intersection_->update(sketch);
+  }
+
+  compact_tuple_sketch_int64_array get_result(bool ordered = true) const {
+    if (!intersection_) throw std::logic_error("the number of values is unknown: no modes and no sketches");
+    return intersection_->get_result(ordered);
+  }
+
+private:
+  uint64_t seed_;
+  std::vector<tuple_mode> modes_;
+  uint8_t num_values_;
+  std::unique_ptr<tuple_intersection_int64_array_base> intersection_;
+
+  void init(size_t num_values) {
+    if (modes_.empty()) modes_.assign(num_values, SUM);
+    const int64_array_modes modes(modes_);
+    num_values_ = modes.get_num_values();
+    intersection_.reset(new tuple_intersection_int64_array_base(seed_, int64_array_intersection_policy(modes)));
+  }
+};
+
+#endif